@@ -0,0 +1,182 @@
+#!/usr/bin/perl -w
+#
+# Regenerate the NFC two-level trie in raptor_nfc_data.c
+#
+# USAGE:
+#   gen-nfc-trie.pl raptor_nfc_data.c > raptor_nfc_data.c.new
+#
+# Reads the charlint generated raptor_nfc_flags and raptor_nfc_classes
+# tables and writes the file back out with everything from the trie
+# comment onwards replaced by freshly generated raptor_nfc_trie_props,
+# raptor_nfc_trie_index and raptor_nfc_trie_leaves tables.  The counts
+# printed to stderr must match the RAPTOR_NFC_*_COUNT defines in
+# raptor_nfc.h.
+#
+# Copyright (C) 2010-2011, David Beckett http://www.dajobe.org/
+#
+# This package is Free Software and part of Redland http://librdf.org/
+#
+# It is licensed under the following three licenses as alternatives:
+#   1. GNU Lesser General Public License (LGPL) V2.1 or any newer version
+#   2. GNU General Public License (GPL) V2 or any newer version
+#   3. Apache License, V2.0 or any newer version
+#
+# You may not use this file except in compliance with at least one of
+# the above three licenses.
+#
+# See LICENSE.html or LICENSE.txt at the top of this package for the
+# complete terms and further detail along with the license texts for
+# the licenses in COPYING.LIB, COPYING and LICENSE-2.0.txt respectively.
+#
+#
+
+use strict;
+
+my $program = $0;
+$program =~ s%^.*/%%;
+
+# Must match RAPTOR_NFC_TRIE_SHIFT in raptor_nfc.h
+my $shift = 5;
+my $block_size = 1 << $shift;
+
+# raptor_nfc_code_flag enum in raptor_nfc.h, in order
+my(@flag_names) = qw(HIGH loww NoNo NOFC ReCo NoRe COM0 Hang hAng haNG HAng Base simp);
+my(%flag_values) = map { $flag_names[$_] => $_ } (0..$#flag_names);
+my $ReCo = $flag_values{ReCo};
+my $NoRe = $flag_values{NoRe};
+
+# Codes U+0 to U+108FF then U+1D000 to U+1D7FF
+my $codes_count = 0x10900 + 0x800;
+
+die "USAGE: $program raptor_nfc_data.c\n"
+  unless @ARGV == 1;
+
+my $file = $ARGV[0];
+open(my $in, '<', $file) or die "$program: Cannot read $file - $!\n";
+my $data = join('', <$in>);
+close($in);
+
+my $trie_start = index($data, "/* Two-level trie");
+die "$program: No trie comment found in $file\n"
+  if $trie_start < 0;
+
+sub table_body($) {
+  my $name = shift;
+  die "$program: No table $name found in $file\n"
+    unless $data =~ m%\b\Q$name\E\[[^\]]*\]\s*=\s*\{(.*?)\};%s;
+  return $1;
+}
+
+
+my(%classes);
+my $classes_body = table_body('raptor_nfc_classes');
+while($classes_body =~ m%\{(0x[0-9A-Fa-f]+),\s*(\d+)\}%g) {
+  $classes{hex($1)} = $2;
+}
+
+my(@flag_bytes);
+my $flags_body = table_body('raptor_nfc_flags');
+$flags_body =~ s%/\*.*?\*/%%gs;
+while($flags_body =~ m%(\w+)\*16\+(\w+)%g) {
+  die "$program: Unknown code flag $1 or $2\n"
+    unless exists $flag_values{$1} && exists $flag_values{$2};
+  push(@flag_bytes, $flag_values{$1} * 16 + $flag_values{$2});
+}
+die "$program: Expected ".($codes_count / 2)." flag bytes, found ".scalar(@flag_bytes)."\n"
+  unless @flag_bytes == $codes_count / 2;
+
+
+sub index_to_code($) {
+  my $i = shift;
+  return ($i < 0x10900) ? $i : $i - 0x10900 + 0x1D000;
+}
+
+
+# Distinct (flag, class) pairs numbered in order of first use
+my(@props);
+my(%props_index);
+my(@values);
+for my $i (0..$codes_count - 1) {
+  my $byte = $flag_bytes[$i >> 1];
+  my $flag = ($i & 1) ? ($byte & 0xF) : ($byte >> 4);
+  my $class = 0;
+  if($flag == $ReCo || $flag == $NoRe) {
+    my $code = index_to_code($i);
+    die sprintf("%s: No combining class for U+%04X\n", $program, $code)
+      unless exists $classes{$code};
+    $class = $classes{$code};
+  }
+  my $key = "$flag,$class";
+  if(!exists $props_index{$key}) {
+    $props_index{$key} = scalar(@props);
+    push(@props, [$flag, $class]);
+  }
+  push(@values, $props_index{$key});
+}
+
+# Distinct blocks of props numbered in order of first use
+my(@leaves);
+my(%leaves_index);
+my(@trie_index);
+for(my $i = 0; $i < $codes_count; $i += $block_size) {
+  my(@leaf) = @values[$i .. $i + $block_size - 1];
+  my $key = join(',', @leaf);
+  if(!exists $leaves_index{$key}) {
+    $leaves_index{$key} = scalar(@leaves);
+    push(@leaves, \@leaf);
+  }
+  push(@trie_index, $leaves_index{$key});
+}
+
+die "$program: ".scalar(@props)." props do not fit in a u8\n"
+  if @props > 256;
+die "$program: ".scalar(@leaves)." leaves do not fit in a u8\n"
+  if @leaves > 256;
+
+
+print substr($data, 0, $trie_start);
+
+print <<"EOT";
+/* Two-level trie over the code flags and combining classes above,
+ * derived from raptor_nfc_flags and raptor_nfc_classes by
+ * scripts/gen-nfc-trie.pl - regenerate it when those change.
+ * See raptor_nfc.h for the layout.
+ */
+
+/* Code flag and combining class pairs referenced by the trie leaves */
+const raptor_nfc_props raptor_nfc_trie_props[RAPTOR_NFC_PROPS_COUNT] = {
+EOT
+my(@rows) = map { sprintf("{%s, %3d}", $flag_names[$_->[0]], $_->[1]) } @props;
+for(my $i = 0; $i < @rows; $i += 5) {
+  my $end = ($i + 5 < @rows) ? $i + 4 : $#rows;
+  print "    ", join(',  ', @rows[$i .. $end]), ($end < $#rows ? "," : ""), "\n";
+}
+print "};\n\n\n";
+
+print "/* Leaf number for each block of RAPTOR_NFC_TRIE_BLOCK_SIZE codes */\n";
+print "const u8 raptor_nfc_trie_index[RAPTOR_NFC_TRIE_INDEX_COUNT] = {\n";
+for(my $i = 0; $i < @trie_index; $i += 8) {
+  my $end = ($i + 8 < @trie_index) ? $i + 7 : $#trie_index;
+  printf("    /* U+%04X */ %s%s\n", index_to_code($i * $block_size),
+         join(', ', map { sprintf("%3d", $_) } @trie_index[$i .. $end]),
+         ($end < $#trie_index ? "," : ""));
+}
+print "};\n\n\n";
+
+print "/* Index of raptor_nfc_trie_props for each code in a block */\n";
+print "const u8 raptor_nfc_trie_leaves[RAPTOR_NFC_TRIE_LEAVES_COUNT][RAPTOR_NFC_TRIE_BLOCK_SIZE] = {\n";
+my $half = $block_size / 2;
+for my $n (0..$#leaves) {
+  my $leaf = $leaves[$n];
+  printf("    /* %3d */ {%s,\n", $n,
+         join(', ', map { sprintf("%2d", $_) } @$leaf[0 .. $half - 1]));
+  printf("              %s}%s\n",
+         join(', ', map { sprintf("%2d", $_) } @$leaf[$half .. $block_size - 1]),
+         ($n < $#leaves ? "," : ""));
+}
+print "};\n";
+
+printf(STDERR "%s: RAPTOR_NFC_PROPS_COUNT %d  RAPTOR_NFC_TRIE_INDEX_COUNT %d  RAPTOR_NFC_TRIE_LEAVES_COUNT %d\n",
+       $program, scalar(@props), scalar(@trie_index), scalar(@leaves));
+
+exit 0;
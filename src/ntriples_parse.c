@@ -59,14 +59,19 @@
 /* Prototypes for local functions */
 static void raptor_ntriples_generate_statement(raptor_parser* parser, const unsigned char *subject, const raptor_term_type subject_type, const unsigned char *predicate, const raptor_term_type predicate_type, const void *object, const raptor_term_type object_type, const unsigned char *object_literal_language, const unsigned char *object_literal_datatype, const void *graph, const raptor_term_type graph_type);
 
+#define MAX_NTRIPLES_TERMS 4
+
+
 /*
  * NTriples parser object
  */
 struct raptor_ntriples_parser_context_s {
-  /* current line */
+  /* current line buffer - reused for all chunks */
   unsigned char *line;
   /* current line length */
   size_t line_length;
+  /* allocated size of line buffer */
+  size_t line_size;
   /* current char in line buffer */
   size_t offset;
 
@@ -79,6 +84,9 @@ struct raptor_ntriples_parser_context_s {
   int is_nquads;
 
   int literal_graph_warning;
+
+  /* recently used URI and blank node terms */
+  raptor_term_cache term_cache;
 };
 
 
@@ -122,8 +130,10 @@ raptor_ntriples_parse_terminate(raptor_parser* rdf_parser)
 {
   raptor_ntriples_parser_context *ntriples_parser;
   ntriples_parser = (raptor_ntriples_parser_context*)rdf_parser->context;
-  if(ntriples_parser->line_length)
+  if(ntriples_parser->line)
     RAPTOR_FREE(cdata, ntriples_parser->line);
+
+  raptor_term_cache_clear(&ntriples_parser->term_cache);
 }
 
 
@@ -140,9 +150,10 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
                                    const void *graph,
                                    const raptor_term_type graph_type)
 {
-  /* raptor_ntriples_parser_context *ntriples_parser = (raptor_ntriples_parser_context*)parser->context; */
+  raptor_ntriples_parser_context *ntriples_parser = (raptor_ntriples_parser_context*)parser->context;
+  raptor_term_cache *cache = &ntriples_parser->term_cache;
   raptor_statement *statement = &parser->statement;
-  raptor_uri *predicate_uri = NULL;
+  raptor_term *datatype_term = NULL;
   raptor_uri *datatype_uri = NULL;
 
   if(!parser->emitted_default_graph) {
@@ -151,27 +162,31 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
   }
 
   /* If there is no statement handler - there is nothing else to do */
-  if(!parser->statement_handler)
+  if(!parser->statement_handler && !parser->statement_batch_handler)
     goto cleanup;
 
   /* Two choices for subject from N-Triples */
   if(subject_type == RAPTOR_TERM_TYPE_BLANK) {
-    statement->subject = raptor_new_term_from_blank(parser->world, subject);
+    statement->subject = raptor_term_cache_get_blank(cache, parser->world,
+                                                     subject,
+                                                     strlen((const char*)subject));
   } else {
-    raptor_uri *subject_uri;
-
     /* must be RAPTOR_TERM_TYPE_URI */
-    subject_uri = raptor_new_uri(parser->world, subject);
-    if(!subject_uri) {
+    statement->subject = raptor_term_cache_get_uri(cache, parser->world,
+                                                   subject,
+                                                   strlen((const char*)subject));
+    if(!statement->subject) {
       raptor_parser_error(parser, "Could not create subject uri '%s', skipping", subject);
       goto cleanup;
     }
-    statement->subject = raptor_new_term_from_uri(parser->world, subject_uri);
-    raptor_free_uri(subject_uri);
   }
 
   if(object_literal_datatype) {
-    datatype_uri = raptor_new_uri(parser->world, object_literal_datatype);
+    datatype_term = raptor_term_cache_get_uri(cache, parser->world,
+                                              object_literal_datatype,
+                                              strlen((const char*)object_literal_datatype));
+    if(datatype_term)
+      datatype_uri = datatype_term->value.uri;
     if(!datatype_uri) {
       raptor_parser_error(parser, "Could not create object literal datatype uri '%s', skipping", object_literal_datatype);
       goto cleanup;
@@ -186,36 +201,52 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
       raptor_parser_error(parser, "Illegal ordinal value %d in property '%s'.", predicate_ordinal, predicate);
   }
   
-  predicate_uri = raptor_new_uri(parser->world, predicate);
-  if(!predicate_uri) {
+  statement->predicate = raptor_term_cache_get_uri(cache, parser->world,
+                                                   predicate,
+                                                   strlen((const char*)predicate));
+  if(!statement->predicate) {
     raptor_parser_error(parser, "Could not create predicate uri '%s', skipping", predicate);
     goto cleanup;
   }
-  statement->predicate = raptor_new_term_from_uri(parser->world, predicate_uri);
-  raptor_free_uri(predicate_uri);
-  predicate_uri = NULL;
   
   /* Three choices for object from N-Triples */
   if(object_type == RAPTOR_TERM_TYPE_URI) {
-    raptor_uri *object_uri;
-
-    object_uri = raptor_new_uri(parser->world, (const unsigned char*)object);
-    if(!object_uri) {
+    statement->object = raptor_term_cache_get_uri(cache, parser->world,
+                                                  (const unsigned char*)object,
+                                                  strlen((const char*)object));
+    if(!statement->object) {
       raptor_parser_error(parser, "Could not create object uri '%s', skipping", (const char *)object);
       goto cleanup;
     }
-    statement->object = raptor_new_term_from_uri(parser->world, object_uri);
-    raptor_free_uri(object_uri);
-    object_uri = NULL;
   } else if(object_type == RAPTOR_TERM_TYPE_BLANK) {
-    statement->object = raptor_new_term_from_blank(parser->world, 
-                                                   (const unsigned char*)object);
+    statement->object = raptor_term_cache_get_blank(cache, parser->world, 
+                                                    (const unsigned char*)object,
+                                                    strlen((const char*)object));
   } else { 
     /*  RAPTOR_TERM_TYPE_LITERAL */
-    statement->object = raptor_new_term_from_literal(parser->world,
-                                                     (const unsigned char*)object,
-                                                     datatype_uri,
-                                                     (const unsigned char*)object_literal_language);
+    raptor_term_arena* arena = raptor_parser_get_term_arena(parser);
+
+    if(arena) {
+      size_t language_len = 0;
+      /* the line buffer is only stable until the handler returns so
+       * batched statements need copies */
+      int borrow = RAPTOR_OPTIONS_GET_NUMERIC(parser, RAPTOR_OPTION_PARSE_BORROW_TERMS) &&
+                   !parser->statement_batch_handler;
+
+      if(object_literal_language)
+        language_len = strlen((const char*)object_literal_language);
+      statement->object = raptor_new_term_from_counted_literal_in_arena(arena,
+                                                                        (const unsigned char*)object,
+                                                                        strlen((const char*)object),
+                                                                        datatype_uri,
+                                                                        (const unsigned char*)object_literal_language,
+                                                                        RAPTOR_BAD_CAST(unsigned char, language_len),
+                                                                        borrow);
+    } else
+      statement->object = raptor_new_term_from_literal(parser->world,
+                                                       (const unsigned char*)object,
+                                                       datatype_uri,
+                                                       (const unsigned char*)object_literal_language);
   }
 
 
@@ -224,21 +255,19 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
      * http://sw.deri.org/2008/07/n-quads/ but I am IGNORING Literal
      */
     if(graph_type == RAPTOR_TERM_TYPE_URI) {
-      raptor_uri *graph_uri;
-
-      graph_uri = raptor_new_uri(parser->world, (const unsigned char*)graph);
-      if(!graph_uri) {
+      statement->graph = raptor_term_cache_get_uri(cache, parser->world,
+                                                   (const unsigned char*)graph,
+                                                   strlen((const char*)graph));
+      if(!statement->graph) {
         raptor_parser_error(parser,
                             "Could not create object uri '%s', skipping", 
                             (const char *)graph);
         goto cleanup;
       }
-      statement->graph = raptor_new_term_from_uri(parser->world, graph_uri);
-      raptor_free_uri(graph_uri);
-      graph_uri = NULL;
     } else if(graph_type == RAPTOR_TERM_TYPE_BLANK) {
-      statement->graph = raptor_new_term_from_blank(parser->world, 
-                                                    (const unsigned char*)graph);
+      statement->graph = raptor_term_cache_get_blank(cache, parser->world, 
+                                                     (const unsigned char*)graph,
+                                                     strlen((const char*)graph));
     } else { 
       /* Warning about literal graphs is handled below */
       statement->graph = NULL;
@@ -246,15 +275,13 @@ raptor_ntriples_generate_statement(raptor_parser* parser,
   }
 
   /* Generate the statement */
-  (*parser->statement_handler)(parser->user_data, statement);
+  raptor_parser_emit_statement(parser, statement);
 
   cleanup:
   raptor_free_statement(statement);
 
-  if(predicate_uri)
-    raptor_free_uri(predicate_uri);
-  if(datatype_uri)
-    raptor_free_uri(datatype_uri);
+  if(datatype_term)
+    raptor_free_term(datatype_term);
 }
 
 
@@ -274,48 +301,78 @@ typedef enum {
 } raptor_ntriples_term_class;
 
 
+/* Per-byte character class bits used for N-Triples term scanning */
+#define NT_CC_URI            0x01 /* valid in a URI: not > */
+#define NT_CC_STRING         0x02 /* valid in a string: not " */
+#define NT_CC_BNODEID_START  0x04 /* valid first bnodeid char: [A-Za-z] */
+#define NT_CC_BNODEID        0x08 /* valid bnodeid char: [A-Za-z0-9] */
+#define NT_CC_LANGUAGE_START 0x10 /* valid first language char: [A-Za-z0-9] */
+#define NT_CC_LANGUAGE       0x20 /* valid language char: [A-Za-z0-9-] */
+#define NT_CC_ORDINARY       0x40 /* printable ASCII that is not \ */
+#define NT_CC_FULL           0x80 /* any byte */
+
+/* Class bits for every byte value, see NT_CC_* above */
+static const unsigned char raptor_ntriples_char_class[256] = {
+  /* 0x00 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x08 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x10 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x18 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x20 */ 0xC3, 0xC3, 0xC1, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+  /* 0x28 */ 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xE3, 0xC3, 0xC3,
+  /* 0x30 */ 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB, 0xFB,
+  /* 0x38 */ 0xFB, 0xFB, 0xC3, 0xC3, 0xC3, 0xC3, 0xC2, 0xC3,
+  /* 0x40 */ 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x48 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x50 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x58 */ 0xFF, 0xFF, 0xFF, 0xC3, 0x83, 0xC3, 0xC3, 0xC3,
+  /* 0x60 */ 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x68 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x70 */ 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  /* 0x78 */ 0xFF, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0x83,
+  /* 0x80 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x88 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x90 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0x98 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xA0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xA8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xB0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xB8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xC0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xC8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xD0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xD8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xE0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xE8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xF0 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
+  /* 0xF8 */ 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83
+};
+
+/* Class bits a byte must have to be valid in a term of each class
+ * as the first character (index 0) and subsequent characters (index 1).
+ * Indexed by raptor_ntriples_term_class.
+ */
+static const unsigned char raptor_ntriples_term_class_bits[][2] = {
+  { NT_CC_URI, NT_CC_URI },
+  { NT_CC_BNODEID_START, NT_CC_BNODEID },
+  { NT_CC_STRING, NT_CC_STRING },
+  { NT_CC_LANGUAGE_START, NT_CC_LANGUAGE },
+  { NT_CC_FULL, NT_CC_FULL }
+};
+
+
 static int 
 raptor_ntriples_term_valid(raptor_parser* rdf_parser,
                            unsigned char c, int position, 
                            raptor_ntriples_term_class term_class) 
 {
-  int result = 0;
-
-  switch(term_class) {
-    case RAPTOR_TERM_CLASS_URI:
-      /* ends on > */
-      result = (c != '>');
-      break;
-      
-    case RAPTOR_TERM_CLASS_BNODEID:  
-      /* ends on first non [A-Za-z][A-Za-z0-9]* */
-      result = IS_ASCII_ALPHA(c);
-      if(position)
-        result = (result || IS_ASCII_DIGIT(c));
-      break;
-      
-    case RAPTOR_TERM_CLASS_STRING:
-      /* ends on " */
-      result = (c != '"');
-      break;
-
-    case RAPTOR_TERM_CLASS_LANGUAGE:
-      /* ends on first non [a-z0-9]+ ('-' [a-z0-9]+ )? */
-      result = (IS_ASCII_ALPHA(c) || IS_ASCII_DIGIT(c));
-      if(position)
-        result = (result || c == '-');
-      break;
-      
-    case RAPTOR_TERM_CLASS_FULL:
-      result = 1;
-      break;
-      
-    default:
-      raptor_parser_error(rdf_parser, "Unknown N-Triples term class %d",
-                          term_class);
+  if(term_class > RAPTOR_TERM_CLASS_FULL) {
+    raptor_parser_error(rdf_parser, "Unknown N-Triples term class %d",
+                        term_class);
+    return 0;
   }
 
-  return result;
+  return (raptor_ntriples_char_class[c] &
+          raptor_ntriples_term_class_bits[term_class][position ? 1 : 0]) != 0;
 }
 
 
@@ -363,12 +420,59 @@ raptor_ntriples_term(raptor_parser* rdf_parser,
   unsigned long unichar = 0;
   unsigned int position = 0;
   int end_char_seen = 0;
+  unsigned char run_first_mask = 0;
+  unsigned char run_mask = 0;
 
   if(term_class == RAPTOR_TERM_CLASS_FULL)
     end_char = '\0';
-  
+
+  /* Bytes matching these masks are copied in runs; any other byte
+   * (escapes, end char, UTF-8, invalid) goes through the checks below.
+   * The fast path is disabled if end_char would be copied as part of a run.
+   */
+  if(term_class <= RAPTOR_TERM_CLASS_FULL) {
+    run_first_mask = NT_CC_ORDINARY | raptor_ntriples_term_class_bits[term_class][0];
+    run_mask = NT_CC_ORDINARY | raptor_ntriples_term_class_bits[term_class][1];
+    if(end_char &&
+       (raptor_ntriples_char_class[(unsigned char)end_char] & run_mask) == run_mask)
+      run_first_mask = run_mask = 0;
+  }
+
   /* find end of string, fixing backslashed characters on the way */
   while(*lenp > 0) {
+    if(run_first_mask) {
+      /* Fast path: a run of printable ASCII bytes valid for this
+       * term class with no escape or end char needs no per-character
+       * checks so move it in one block.
+       */
+      const unsigned char *q = p;
+      const unsigned char *q_end = p + *lenp;
+      size_t run;
+
+      if(!position &&
+         (raptor_ntriples_char_class[*q] & run_first_mask) == run_first_mask)
+        q++;
+      if(position || q != p) {
+        while(q < q_end &&
+              (raptor_ntriples_char_class[*q] & run_mask) == run_mask)
+          q++;
+      }
+
+      run = RAPTOR_GOOD_CAST(size_t, q - p);
+      if(run) {
+        if(dest != p)
+          memmove(dest, p, run);
+        dest += run;
+        p += run;
+        (*lenp) -= run;
+        position += RAPTOR_GOOD_CAST(unsigned int, run);
+        rdf_parser->locator.column += RAPTOR_GOOD_CAST(int, run);
+        rdf_parser->locator.byte += RAPTOR_GOOD_CAST(int, run);
+        if(!*lenp)
+          break;
+      }
+    }
+
     c = *p;
 
     p++;
@@ -378,23 +482,25 @@ raptor_ntriples_term(raptor_parser* rdf_parser,
 
     if(allow_utf8) {
       if(c > 0x7f) {
-        /* just copy the UTF-8 bytes through */
-        int unichar_len;
-        unichar_len = raptor_unicode_utf8_string_get_char(p - 1, 1 + *lenp, NULL);
-        if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > *lenp) {
+        /* just copy the run of UTF-8 bytes through once it is valid */
+        size_t run;
+
+        for(run = 1; run <= *lenp && p[run - 1] > 0x7f; run++)
+          ;
+        if(!raptor_unicode_check_utf8_string(p - 1, run)) {
           raptor_parser_error(rdf_parser, "UTF-8 encoding error at character %d (0x%02X) found.", c, c);
           /* UTF-8 encoding had an error or ended in the middle of a string */
           return 1;
         }
-        memcpy(dest, p-1, unichar_len);
-        dest += unichar_len;
+        memcpy(dest, p - 1, run);
+        dest += run;
 
-        unichar_len--; /* p, *lenp were moved on by 1 earlier */
+        run--; /* p, *lenp were moved on by 1 earlier */
         
-        p += unichar_len;
-        (*lenp) -= unichar_len;
-        rdf_parser->locator.column += unichar_len;
-        rdf_parser->locator.byte += unichar_len;
+        p += run;
+        (*lenp) -= run;
+        rdf_parser->locator.column += RAPTOR_GOOD_CAST(int, run);
+        rdf_parser->locator.byte += RAPTOR_GOOD_CAST(int, run);
         continue;
       }
     } else if(!IS_ASCII_PRINT(c)) {
@@ -528,8 +634,6 @@ raptor_ntriples_term(raptor_parser* rdf_parser,
 }
 
 
-#define MAX_NTRIPLES_TERMS 4
-
 static int
 raptor_ntriples_parse_line(raptor_parser* rdf_parser,
                            unsigned char *buffer, size_t len,
@@ -872,18 +976,27 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
   if(!len)
     return 0;
 
-  buffer = RAPTOR_MALLOC(unsigned char*, ntriples_parser->line_length + len + 1);
-  if(!buffer) {
-    raptor_parser_fatal_error(rdf_parser, "Out of memory");
-    return 1;
-  }
+  /* Grow the line buffer only if the new data does not fit after
+   * any partial line left over from the last chunk; otherwise it is
+   * reused as-is so there is no per-chunk allocation.
+   */
+  if(ntriples_parser->line_length + len + 1 > ntriples_parser->line_size) {
+    size_t new_size = ntriples_parser->line_size << 1;
+
+    if(new_size < ntriples_parser->line_length + len + 1)
+      new_size = ntriples_parser->line_length + len + 1;
 
-  if(ntriples_parser->line_length) {
-    memcpy(buffer, ntriples_parser->line, ntriples_parser->line_length);
-    RAPTOR_FREE(char*, ntriples_parser->line);
+    buffer = RAPTOR_REALLOC(unsigned char*, ntriples_parser->line, new_size);
+    if(!buffer) {
+      raptor_parser_fatal_error(rdf_parser, "Out of memory");
+      return 1;
+    }
+
+    ntriples_parser->line = buffer;
+    ntriples_parser->line_size = new_size;
   }
 
-  ntriples_parser->line = buffer;
+  buffer = ntriples_parser->line;
 
   /* move pointer to end of cdata buffer */
   ptr = buffer+ntriples_parser->line_length;
@@ -919,8 +1032,9 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
       start = line_start = ptr;
     }
 
-    while(*ptr && *ptr != '\n' && *ptr != '\r')
-      ptr++;
+    /* strcspn() stops at the terminating NUL too and is usually
+     * much faster than a byte loop on long lines */
+    ptr += strcspn((const char*)ptr, "\r\n");
 
     if(!*ptr)
       break;
@@ -958,36 +1072,26 @@ raptor_ntriples_parse_chunk(raptor_parser* rdf_parser,
   len = ntriples_parser->line_length - ntriples_parser->offset;
     
   if(len) {
-    /* collapse buffer */
+    /* collapse buffer: move the partial line to the start */
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
     RAPTOR_DEBUG3("collapsing buffer from %d to %d bytes\n", ntriples_parser->line_length, (unsigned int)len);
 #endif
-    buffer = RAPTOR_MALLOC(unsigned char*, len + 1);
-    if(!buffer) {
-      raptor_parser_fatal_error(rdf_parser, "Out of memory");
-      return 1;
-    }
-
-    memcpy(buffer, 
-           ntriples_parser->line + ntriples_parser->line_length - len,
-           len);
+    if(ntriples_parser->offset)
+      memmove(buffer, buffer + ntriples_parser->offset, len);
     buffer[len] = '\0';
 
-    RAPTOR_FREE(char*, ntriples_parser->line);
-
-    ntriples_parser->line = buffer;
-    ntriples_parser->line_length -= ntriples_parser->offset;
-    ntriples_parser->offset = 0;
-
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
     RAPTOR_DEBUG3("buffer now '%s' (%d bytes)\n", ntriples_parser->line, ntriples_parser->line_length);
 #endif    
   }
+
+  ntriples_parser->line_length = len;
+  ntriples_parser->offset = 0;
   
   /* exit now, no more input */
   if(is_end) {
-    if(ntriples_parser->offset != ntriples_parser->line_length) {
+    if(ntriples_parser->line_length) {
        raptor_parser_error(rdf_parser, "Junk at end of input.\"");
        return 1;
     }
@@ -1016,6 +1120,10 @@ raptor_ntriples_parse_start(raptor_parser* rdf_parser)
 
   ntriples_parser->last_char = '\0';
 
+  /* keep the line buffer allocation, discard any old partial line */
+  ntriples_parser->line_length = 0;
+  ntriples_parser->offset = 0;
+
   return 0;
 }
 
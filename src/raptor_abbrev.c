@@ -339,6 +339,144 @@ raptor_abbrev_subject_invalidate(raptor_abbrev_subject *subject)
   
 
 
+/**
+ * raptor_abbrev_subject_uses_blank:
+ * @subject: subject
+ *
+ * INTERNAL - Check if a subject is a blank node or has a blank node object
+ *
+ * Return value: non-0 if a blank node is used
+ */
+int
+raptor_abbrev_subject_uses_blank(raptor_abbrev_subject* subject)
+{
+  raptor_avltree_iterator* iter;
+  int i;
+  int rc = 0;
+
+  if(subject->node->term->type == RAPTOR_TERM_TYPE_BLANK)
+    return 1;
+
+  for(i = 0; i < raptor_sequence_size(subject->list_items); i++) {
+    raptor_abbrev_node* node;
+
+    node = (raptor_abbrev_node*)raptor_sequence_get_at(subject->list_items, i);
+    if(node && node->term->type == RAPTOR_TERM_TYPE_BLANK)
+      return 1;
+  }
+
+  iter = raptor_new_avltree_iterator(subject->properties, NULL, NULL, 1);
+  while(iter) {
+    raptor_abbrev_node** nodes;
+
+    nodes = (raptor_abbrev_node**)raptor_avltree_iterator_get(iter);
+    if(nodes && nodes[1]->term->type == RAPTOR_TERM_TYPE_BLANK) {
+      rc = 1;
+      break;
+    }
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+
+  return rc;
+}
+
+
+/* add @node to the @used tree of nodes, holding a reference */
+static int
+raptor_abbrev_node_add_used(raptor_avltree* used, raptor_abbrev_node* node)
+{
+  if(!node)
+    return 0;
+
+  node->ref_count++;
+  /* a node already in the tree is freed, dropping the reference again */
+  return raptor_avltree_add(used, node) < 0;
+}
+
+
+/**
+ * raptor_abbrev_subject_delete:
+ * @nodes: AVL-Tree of nodes
+ * @subjects: AVL-Tree of subjects holding @subject
+ * @subject: subject to delete
+ *
+ * INTERNAL - Delete a subject and the nodes that only it used
+ *
+ * Blank nodes are always kept in @nodes since their use counts
+ * decide how they are written.
+ *
+ * Return value: non-0 on failure
+ */
+int
+raptor_abbrev_subject_delete(raptor_avltree* nodes, raptor_avltree* subjects,
+                             raptor_abbrev_subject* subject)
+{
+  raptor_avltree* used;
+  raptor_avltree_iterator* iter;
+  int i;
+  int rc = 0;
+
+  used = raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_node_compare,
+                            (raptor_data_free_handler)raptor_free_abbrev_node,
+                            0);
+  if(!used)
+    return 1;
+
+  rc = raptor_abbrev_node_add_used(used, subject->node);
+  if(!rc)
+    rc = raptor_abbrev_node_add_used(used, subject->node_type);
+  for(i = 0; !rc && i < raptor_sequence_size(subject->list_items); i++)
+    rc = raptor_abbrev_node_add_used(used,
+                                     (raptor_abbrev_node*)raptor_sequence_get_at(subject->list_items, i));
+
+  iter = raptor_new_avltree_iterator(subject->properties, NULL, NULL, 1);
+  while(!rc && iter) {
+    raptor_abbrev_node** po;
+
+    po = (raptor_abbrev_node**)raptor_avltree_iterator_get(iter);
+    if(po) {
+      rc = raptor_abbrev_node_add_used(used, po[0]);
+      if(!rc)
+        rc = raptor_abbrev_node_add_used(used, po[1]);
+    }
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+
+  if(!rc) {
+    if(raptor_avltree_remove(subjects, subject))
+      raptor_free_abbrev_subject(subject);
+    else
+      rc = 1;
+  }
+
+  if(!rc) {
+    /* nodes now referenced only by @nodes and @used are unused */
+    iter = raptor_new_avltree_iterator(used, NULL, NULL, 1);
+    while(iter) {
+      raptor_abbrev_node* node;
+
+      node = (raptor_abbrev_node*)raptor_avltree_iterator_get(iter);
+      if(node && node->ref_count == 2 &&
+         node->term->type != RAPTOR_TERM_TYPE_BLANK)
+        raptor_avltree_delete(nodes, node);
+      if(raptor_avltree_iterator_next(iter))
+        break;
+    }
+    if(iter)
+      raptor_free_avltree_iterator(iter);
+  }
+
+  raptor_free_avltree(used);
+
+  return rc;
+}
+
 /**
  * raptor_subject_add_property:
  * @subject: subject node to add to
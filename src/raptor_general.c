@@ -281,23 +281,48 @@ raptor_world_set_generate_bnodeid_handler(raptor_world* world,
 }
 
 
-static unsigned char*
-raptor_world_default_generate_bnodeid_handler(void *user_data,
-                                              unsigned char *user_bnodeid) 
+/*
+ * raptor_world_next_default_bnodeid:
+ * @world: world
+ * @id_p: pointer to store the ID number
+ *
+ * INTERNAL - Take the next blank node ID number from the default generator
+ *
+ * Return value: length of the ID when formatted by
+ * raptor_world_format_default_bnodeid()
+ */
+size_t
+raptor_world_next_default_bnodeid(raptor_world *world, int *id_p)
 {
-  raptor_world *world = (raptor_world*)user_data;
   int id;
-  unsigned char *buffer;
-  const char* prefix;
-  unsigned int prefix_length;
-  int id_length;
+  size_t prefix_length = 5; /* strlen("genid") */
 
-  if(user_bnodeid)
-    return user_bnodeid;
+  id = RAPTOR_USAGE_INCR(world, world->default_generate_bnodeid_handler_base);
+  *id_p = id;
+
+  if(world->default_generate_bnodeid_handler_prefix)
+    prefix_length = world->default_generate_bnodeid_handler_prefix_length;
+
+  return prefix_length + 
+    RAPTOR_GOOD_CAST(size_t, raptor_format_integer(NULL, 0, id, /* base */ 10, -1, '\0'));
+}
 
-  id = ++world->default_generate_bnodeid_handler_base;
 
-  id_length = raptor_format_integer(NULL, 0, id, /* base */ 10, -1, '\0');
+/*
+ * raptor_world_format_default_bnodeid:
+ * @world: world
+ * @id: ID number from raptor_world_next_default_bnodeid()
+ * @buffer: buffer of at least @length + 1 bytes
+ * @length: length from raptor_world_next_default_bnodeid()
+ *
+ * INTERNAL - Format a default generated blank node ID with its prefix
+ */
+void
+raptor_world_format_default_bnodeid(raptor_world *world, int id,
+                                    unsigned char *buffer, size_t length)
+{
+  const char* prefix;
+  size_t prefix_length;
 
   if(world->default_generate_bnodeid_handler_prefix) {
     prefix = world->default_generate_bnodeid_handler_prefix;
@@ -307,13 +332,32 @@ raptor_world_default_generate_bnodeid_handler(void *user_data,
     prefix_length = 5; /* strlen("genid") */
   }
 
-  buffer = RAPTOR_MALLOC(unsigned char*, id_length + prefix_length + 1);
+  memcpy(buffer, prefix, prefix_length);
+  (void)raptor_format_integer(RAPTOR_GOOD_CAST(char*, &buffer[prefix_length]),
+                              length - prefix_length + 1, id, /* base */ 10,
+                              -1, '\0');
+}
+
+
+static unsigned char*
+raptor_world_default_generate_bnodeid_handler(void *user_data,
+                                              unsigned char *user_bnodeid) 
+{
+  raptor_world *world = (raptor_world*)user_data;
+  int id;
+  unsigned char *buffer;
+  size_t length;
+
+  if(user_bnodeid)
+    return user_bnodeid;
+
+  length = raptor_world_next_default_bnodeid(world, &id);
+
+  buffer = RAPTOR_MALLOC(unsigned char*, length + 1);
   if(!buffer)
     return NULL;
 
-  memcpy(buffer, prefix, prefix_length);
-  (void)raptor_format_integer(RAPTOR_GOOD_CAST(char*, &buffer[prefix_length]),
-                              id_length + 1, id, /* base */ 10,-1, '\0');
+  raptor_world_format_default_bnodeid(world, id, buffer, length);
 
   return buffer;
 }
@@ -478,6 +522,15 @@ raptor_world_set_flag(raptor_world *world, raptor_world_flag flag, int value)
     case RAPTOR_WORLD_FLAG_WWW_SKIP_INIT_FINISH:
       world->www_skip_www_init_finish = value;
       break;
+
+    case RAPTOR_WORLD_FLAG_THREAD_SAFE:
+#ifdef RAPTOR_WORLD_THREADS
+      world->thread_safe = value;
+#else
+      if(value)
+        rc = -2;
+#endif
+      break;
       
     default:
       rc = -1;
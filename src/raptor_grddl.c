@@ -645,9 +645,17 @@ raptor_grddl_ensure_internal_parser(raptor_parser* rdf_parser,
   if(filter) {
     grddl_parser->internal_parser->user_data = rdf_parser;
     grddl_parser->internal_parser->statement_handler = raptor_grddl_filter_triples;
+    if(raptor_parser_set_statement_batch_handler(grddl_parser->internal_parser,
+                                                 NULL, NULL, 0))
+      return 1;
   } else {
     grddl_parser->internal_parser->user_data = grddl_parser->saved_user_data;
     grddl_parser->internal_parser->statement_handler = grddl_parser->saved_statement_handler;
+    if(raptor_parser_set_statement_batch_handler(grddl_parser->internal_parser,
+                                                 rdf_parser->statement_batch_user_data,
+                                                 rdf_parser->statement_batch_handler,
+                                                 rdf_parser->statement_batch_size))
+      return 1;
   }
 
   return 0;
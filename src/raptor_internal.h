@@ -46,6 +46,15 @@ extern "C" {
 #undef HAVE_STDLIB_H
 #endif
 
+/* for memcpy() in the inlined iostream writes */
+#include <string.h>
+
+/* A world can be shared between threads (RAPTOR_WORLD_FLAG_THREAD_SAFE) */
+#if defined(HAVE_PTHREAD) && defined(HAVE_ATOMIC_BUILTINS)
+#define RAPTOR_WORLD_THREADS 1
+#include <pthread.h>
+#endif
+
 /* Can be over-ridden or undefined in a config.h file or -Ddefine */
 #ifndef RAPTOR_INLINE
 #define RAPTOR_INLINE inline
@@ -201,6 +210,7 @@ typedef struct raptor_parser_factory_s raptor_parser_factory;
 typedef struct raptor_serializer_factory_s raptor_serializer_factory;
 typedef struct raptor_id_set_s raptor_id_set;
 typedef struct raptor_uri_detail_s raptor_uri_detail;
+typedef struct raptor_term_arena_s raptor_term_arena;
 
 
 /* raptor_option.c */
@@ -394,8 +404,88 @@ void raptor_concepts_finish(raptor_world* world);
 
 
 /* raptor_iostream.c */
+
+/* Default write buffer sizes for iostreams to files and to strings */
+#define RAPTOR_IOSTREAM_FILE_BUFFER_SIZE 65536
+#define RAPTOR_IOSTREAM_STRING_BUFFER_SIZE 1024
+
+struct raptor_iostream_s
+{
+  raptor_world *world;
+  
+  void *user_data;
+  const raptor_iostream_handler* handler;
+  unsigned long offset;
+  unsigned int mode;
+  int flags;
+
+  /* write buffer of bytes not yet passed to the handler; allocated
+   * with buffer_request bytes at the first write.  buffer_size is 0
+   * until then and when writes are unbuffered. */
+  unsigned char *buffer;
+  size_t buffer_length;
+  size_t buffer_size;
+  size_t buffer_request;
+};
+
 raptor_world* raptor_iostream_get_world(raptor_iostream *iostr);
 
+/*
+ * raptor_iostream_put_byte:
+ * @byte: byte to write
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - raptor_iostream_write_byte() inlined for when there is room in the write buffer
+ *
+ * Return value: non-0 on failure
+ */
+static RAPTOR_INLINE int
+raptor_iostream_put_byte(const int byte, raptor_iostream *iostr)
+{
+  if(iostr->buffer_length < iostr->buffer_size) {
+    iostr->buffer[iostr->buffer_length++] = (unsigned char)byte;
+    iostr->offset++;
+    return 0;
+  }
+
+  return raptor_iostream_write_byte(byte, iostr);
+}
+
+/*
+ * raptor_iostream_put_counted_string:
+ * @string: string
+ * @len: string length
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - raptor_iostream_counted_string_write() inlined for when there is room in the write buffer
+ *
+ * Return value: non-0 on failure
+ */
+static RAPTOR_INLINE int
+raptor_iostream_put_counted_string(const void *string, size_t len,
+                                   raptor_iostream *iostr)
+{
+  if(len < iostr->buffer_size - iostr->buffer_length) {
+    memcpy(iostr->buffer + iostr->buffer_length, string, len);
+    iostr->buffer_length += len;
+    iostr->offset += len;
+    return 0;
+  }
+
+  return raptor_iostream_counted_string_write(string, len, iostr);
+}
+
+
+/* Size of the namespace stack name cache; must be a power of 2 */
+#define RAPTOR_NAMESPACE_NAME_CACHE_SIZE 256
+
+/* Namespace stack name cache entry: a URI for a (namespace URI, local name) */
+typedef struct {
+  /* namespace URI (reference held) or NULL if empty */
+  raptor_uri* ns_uri;
+  /* namespace URI + local name (reference held) */
+  raptor_uri* uri;
+} raptor_namespace_name_cache_entry;
 
 /* Raptor Namespace Stack node */
 struct raptor_namespace_stack_s {
@@ -408,6 +498,10 @@ struct raptor_namespace_stack_s {
 
   raptor_uri *rdf_ms_uri;
   raptor_uri *rdf_schema_uri;
+
+  /* cache of resolved names, allocated on first use; see
+   * raptor_namespace_local_name_to_uri() */
+  raptor_namespace_name_cache_entry* name_cache;
 };
 
 
@@ -441,6 +535,7 @@ struct raptor_namespace_s {
 };
 
 raptor_namespace** raptor_namespace_stack_to_array(raptor_namespace_stack *nstack, size_t *size_p);
+raptor_uri* raptor_namespace_local_name_to_uri(const raptor_namespace* ns, const unsigned char* local_name, unsigned int local_name_length);
 
 #ifdef RAPTOR_XML_LIBXML
 #define RAPTOR_LIBXML_MAGIC 0x8AF108
@@ -454,6 +549,9 @@ raptor_namespace** raptor_namespace_stack_to_array(raptor_namespace_stack *nstac
 #define RAPTOR_READ_BUFFER_SIZE 4096
 #endif
 
+/* Default number of statements passed to a statement batch handler */
+#define RAPTOR_STATEMENT_BATCH_SIZE 256
+
 
 /*
  * Raptor parser object
@@ -498,6 +596,19 @@ struct raptor_parser_s {
   /* parser callbacks */
   raptor_statement_handler statement_handler;
 
+  /* batched statement callback, used instead of statement_handler
+   * when set, with the statements collected so far */
+  raptor_statement_batch_handler statement_batch_handler;
+  void *statement_batch_user_data;
+  raptor_statement* statement_batch;
+  int statement_batch_size;
+  int statement_batch_count;
+
+  /* arena for literal terms when RAPTOR_OPTION_PARSE_ARENA or
+   * RAPTOR_OPTION_PARSE_BORROW_TERMS is set;
+   * see raptor_parser_get_term_arena() */
+  raptor_term_arena* term_arena;
+
   raptor_graph_mark_handler graph_mark_handler;
 
   void* uri_filter_user_data;
@@ -673,6 +784,8 @@ raptor_parser_factory* raptor_world_register_parser_factory(raptor_world* world,
 int raptor_parser_factory_add_mime_type(raptor_parser_factory* factory, const char* mime_type, int q);
 
 unsigned char* raptor_world_internal_generate_id(raptor_world *world, unsigned char *user_bnodeid);
+size_t raptor_world_next_default_bnodeid(raptor_world *world, int *id_p);
+void raptor_world_format_default_bnodeid(raptor_world *world, int id, unsigned char *buffer, size_t length);
 
 #ifdef RAPTOR_DEBUG
 void raptor_stats_print(raptor_parser *rdf_parser, FILE *stream);
@@ -680,6 +793,32 @@ void raptor_stats_print(raptor_parser *rdf_parser, FILE *stream);
 const char* raptor_basename(const char *name);
 int raptor_term_print_as_ntriples(const raptor_term *term, FILE* stream);
 
+/* raptor_term.c */
+
+/* number of slots in a raptor_term_cache - must be a power of 2 */
+#define RAPTOR_TERM_CACHE_SIZE 64
+
+/*
+ * Cache of recently used URI and blank node terms, keyed by their
+ * strings.  Each slot holds one reference to its term.
+ */
+typedef struct {
+  raptor_term* terms[RAPTOR_TERM_CACHE_SIZE];
+} raptor_term_cache;
+
+raptor_term* raptor_term_cache_get_uri(raptor_term_cache* cache, raptor_world* world, const unsigned char* uri_string, size_t length);
+raptor_term* raptor_term_cache_get_term_from_uri(raptor_term_cache* cache, raptor_world* world, raptor_uri* uri);
+raptor_term* raptor_term_cache_get_blank(raptor_term_cache* cache, raptor_world* world, const unsigned char* blank, size_t length);
+void raptor_term_cache_clear(raptor_term_cache* cache);
+
+raptor_term* raptor_new_term_from_generated_blank(raptor_world* world, unsigned char* user_bnodeid);
+raptor_term* raptor_new_term_from_counted_generated_blank(raptor_world* world, const unsigned char* user_bnodeid, size_t length);
+
+raptor_term_arena* raptor_new_term_arena(raptor_world* world);
+void raptor_free_term_arena(raptor_term_arena* arena);
+void raptor_term_arena_reset(raptor_term_arena* arena);
+raptor_term* raptor_new_term_from_counted_literal_in_arena(raptor_term_arena* arena, const unsigned char* literal, size_t literal_len, raptor_uri* datatype, const unsigned char* language, unsigned char language_len, int borrow);
+
 /* raptor_parse.c */
 raptor_parser_factory* raptor_world_get_parser_factory(raptor_world* world, const char *name);  
 void raptor_delete_parser_factories(void);
@@ -853,6 +992,9 @@ void raptor_parsers_finish(raptor_world *world);
 void raptor_parser_save_content(raptor_parser* rdf_parser, int save);
 const unsigned char* raptor_parser_get_content(raptor_parser* rdf_parser, size_t* length_p);
 void raptor_parser_start_graph(raptor_parser* parser, raptor_uri* uri, int is_declared);
+void raptor_parser_emit_statement(raptor_parser* parser, raptor_statement* statement);
+void raptor_parser_flush_statement_batch(raptor_parser* parser);
+raptor_term_arena* raptor_parser_get_term_arena(raptor_parser* parser);
 void raptor_parser_end_graph(raptor_parser* parser, raptor_uri* uri, int is_declared);
 
 /* raptor_rss.c */
@@ -865,6 +1007,7 @@ extern const unsigned char * const raptor_atom_namespace_uri;
 raptor_uri_detail* raptor_new_uri_detail(const unsigned char *uri_string);
 void raptor_free_uri_detail(raptor_uri_detail* uri_detail);
 unsigned char* raptor_uri_detail_to_string(raptor_uri_detail *ud, size_t* len_p);
+size_t raptor_uri_resolve_uri_reference_detail(const unsigned char *base_uri, raptor_uri_detail *base_detail, const unsigned char *reference_uri, unsigned char *buffer, size_t length);
 
 /* serializers */
 /* raptor_serializer.c */
@@ -899,6 +1042,8 @@ extern const raptor_unichar raptor_unicode_max_codepoint;
 int raptor_unicode_is_namestartchar(raptor_unichar c);
 int raptor_unicode_is_namechar(raptor_unichar c);
 int raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length);
+size_t raptor_unicode_utf8_ascii_span(const unsigned char *string, size_t length);
+size_t raptor_unicode_utf8_valid_length(const unsigned char *string, size_t length);
 
 /* raptor_www*.c */
 #ifdef RAPTOR_WWW_LIBXML
@@ -1102,6 +1247,8 @@ struct raptor_sax2_s {
 int raptor_sax2_init(raptor_world* world);
 void raptor_sax2_finish(raptor_world* world);
 
+/* raptor_xml.c */
+int raptor_xml_escape_string_common_write(const unsigned char *string, size_t len, char quote, int xml_version, int check_utf8, raptor_iostream* iostr);
 
 raptor_xml_element* raptor_xml_element_pop(raptor_sax2* sax2);
 void raptor_xml_element_push(raptor_sax2* sax2, raptor_xml_element* element);
@@ -1189,6 +1336,7 @@ typedef void (*raptor_simple_message_handler)(void *user_data, const char *messa
 
 
 /* turtle_common.c */
+int raptor_turtle_unescape_string(const unsigned char *text, size_t len, int delim, unsigned char *dest, size_t *dest_len_p, raptor_simple_message_handler error_handler, void *error_data);
 int raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer, const unsigned char *text, size_t len, int delim, raptor_simple_message_handler error_handler, void *error_data);
 
 
@@ -1231,6 +1379,8 @@ raptor_abbrev_subject* raptor_abbrev_subject_find(raptor_avltree *subjects, rapt
 raptor_abbrev_subject* raptor_abbrev_subject_lookup(raptor_avltree* nodes, raptor_avltree* subjects, raptor_avltree* blanks, raptor_term* term);
 int raptor_abbrev_subject_valid(raptor_abbrev_subject *subject);
 int raptor_abbrev_subject_invalidate(raptor_abbrev_subject *subject);
+int raptor_abbrev_subject_uses_blank(raptor_abbrev_subject* subject);
+int raptor_abbrev_subject_delete(raptor_avltree* nodes, raptor_avltree* subjects, raptor_abbrev_subject* subject);
 
 
 /* avltree */
@@ -1319,6 +1469,38 @@ int raptor_format_integer(char* buffer, size_t bufsize, int integer, unsigned in
 int raptor_check_world_internal(raptor_world* world, const char* name);
 
 
+/*
+ * Reference count updates for objects that may be shared between
+ * threads via a world with RAPTOR_WORLD_FLAG_THREAD_SAFE set.  Both
+ * evaluate to the new count.
+ */
+#ifdef RAPTOR_WORLD_THREADS
+#define RAPTOR_USAGE_INCR(world, usage) \
+  ((world)->thread_safe ? __atomic_add_fetch(&(usage), 1, __ATOMIC_RELAXED) : ++(usage))
+#define RAPTOR_USAGE_DECR(world, usage) \
+  ((world)->thread_safe ? __atomic_sub_fetch(&(usage), 1, __ATOMIC_ACQ_REL) : --(usage))
+#else
+#define RAPTOR_USAGE_INCR(world, usage) (++(usage))
+#define RAPTOR_USAGE_DECR(world, usage) (--(usage))
+#endif
+
+
+/*
+ * One part of the URI interning table
+ *
+ * Interned URIs are spread over the parts by hash; a world shared
+ * between threads has several parts each with its own lock.
+ */
+typedef struct {
+  /* open addressing hash table with linear probing, size is a power of 2 */
+  raptor_uri** uris;
+  unsigned int size;
+  unsigned int count;
+#ifdef RAPTOR_WORLD_THREADS
+  pthread_mutex_t lock;
+#endif
+} raptor_uri_hash_part;
+
 
 struct raptor_world_s {
   /* signature to check this is a world object */
@@ -1376,7 +1558,10 @@ struct raptor_world_s {
   xmlGenericErrorFunc libxml_saved_generic_error_handler;
 #endif  
 
-  raptor_avltree *uris_tree;
+  /* interned URIs: array of uris_hash_parts_count table parts,
+   * a power of 2 */
+  raptor_uri_hash_part* uris_hash;
+  unsigned int uris_hash_parts_count;
 
   raptor_uri* concepts[RDF_NS_LAST + 1];
 
@@ -1388,6 +1573,9 @@ struct raptor_world_s {
   /* should */
   int uri_interning;
 
+  /* world may be shared between threads - RAPTOR_WORLD_FLAG_THREAD_SAFE */
+  int thread_safe;
+
   /* generate blank node ID policy */
   void *generate_bnodeid_handler_user_data;
   raptor_generate_bnodeid_handler generate_bnodeid_handler;
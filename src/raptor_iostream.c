@@ -48,20 +48,10 @@
 #define RAPTOR_IOSTREAM_FLAGS_EOF           1
 #define RAPTOR_IOSTREAM_FLAGS_FREE_HANDLER  2
 
-struct raptor_iostream_s
-{
-  raptor_world *world;
-  
-  void *user_data;
-  const raptor_iostream_handler* handler;
-  unsigned long offset;
-  unsigned int mode;
-  int flags;
-};
-
 
 
 /* prototypes for local functions */
+static int raptor_iostream_flush_buffer(raptor_iostream *iostr);
 
 
 static int
@@ -305,6 +295,7 @@ raptor_new_iostream_to_filename(raptor_world *world, const char *filename)
   iostr->handler = handler;
   iostr->user_data = (void*)handle;
   iostr->mode = mode;
+  iostr->buffer_request = RAPTOR_IOSTREAM_FILE_BUFFER_SIZE;
 
   if(iostr->handler->init && 
      iostr->handler->init(iostr->user_data)) {
@@ -337,6 +328,10 @@ static const raptor_iostream_handler raptor_iostream_write_file_handler = {
  * The @handle must already be open for writing.
  * NOTE: This does not fclose the @handle when it is finished.
  *
+ * Writes are passed to the @handle unbuffered so that they stay in
+ * order with anything else written to it; use
+ * raptor_iostream_set_write_buffer_size() to buffer them.
+ *
  * Return value: new #raptor_iostream object or NULL on failure
  **/
 raptor_iostream*
@@ -523,6 +518,7 @@ raptor_new_iostream_to_string(raptor_world *world,
   iostr->handler = handler;
   iostr->user_data = (void*)con;
   iostr->mode = mode;
+  iostr->buffer_request = RAPTOR_IOSTREAM_STRING_BUFFER_SIZE;
 
   if(iostr->handler->init && iostr->handler->init(iostr->user_data)) {
     raptor_free_iostream(iostr);
@@ -691,9 +687,14 @@ raptor_free_iostream(raptor_iostream *iostr)
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     raptor_iostream_write_end(iostr);
 
+  raptor_iostream_flush_buffer(iostr);
+
   if(iostr->handler->finish)
     iostr->handler->finish(iostr->user_data);
 
+  if(iostr->buffer)
+    RAPTOR_FREE(char*, iostr->buffer);
+
   if((iostr->flags & RAPTOR_IOSTREAM_FLAGS_FREE_HANDLER))
     RAPTOR_FREE(raptor_iostream_handler, iostr->handler);
 
@@ -702,6 +703,99 @@ raptor_free_iostream(raptor_iostream *iostr)
 
 
 
+/*
+ * raptor_iostream_alloc_buffer:
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - Allocate the write buffer on first write
+ *
+ * If the allocation fails, the iostream stays unbuffered.
+ *
+ * Return value: buffer size or 0 if the iostream is unbuffered
+ */
+static size_t
+raptor_iostream_alloc_buffer(raptor_iostream *iostr)
+{
+  if(iostr->buffer_size || !iostr->buffer_request)
+    return iostr->buffer_size;
+
+  if((iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF) ||
+     !(iostr->mode & RAPTOR_IOSTREAM_MODE_WRITE) ||
+     (!iostr->handler->write_bytes && !iostr->handler->write_byte))
+    return 0;
+
+  iostr->buffer = RAPTOR_MALLOC(unsigned char*, iostr->buffer_request);
+  if(iostr->buffer)
+    iostr->buffer_size = iostr->buffer_request;
+  else
+    iostr->buffer_request = 0;
+
+  return iostr->buffer_size;
+}
+
+
+/*
+ * raptor_iostream_flush_buffer:
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - Pass the buffered bytes to the handler and empty the buffer
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_iostream_flush_buffer(raptor_iostream *iostr)
+{
+  size_t len = iostr->buffer_length;
+  int rc = 0;
+
+  if(!len)
+    return 0;
+
+  iostr->buffer_length = 0;
+
+  if(iostr->handler->write_bytes) {
+    int nobj = iostr->handler->write_bytes(iostr->user_data, iostr->buffer,
+                                           1, len);
+    rc = (RAPTOR_BAD_CAST(size_t, nobj) != len);
+  } else {
+    size_t i;
+
+    for(i = 0; i < len; i++) {
+      if(iostr->handler->write_byte(iostr->user_data, iostr->buffer[i])) {
+        rc = 1;
+        break;
+      }
+    }
+  }
+
+  return rc;
+}
+
+
+/*
+ * raptor_iostream_free_buffer:
+ * @iostr: raptor iostream
+ *
+ * INTERNAL - Flush and free the write buffer, leaving the iostream unbuffered
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_iostream_free_buffer(raptor_iostream *iostr)
+{
+  int rc = raptor_iostream_flush_buffer(iostr);
+
+  if(iostr->buffer) {
+    RAPTOR_FREE(char*, iostr->buffer);
+    iostr->buffer = NULL;
+  }
+  iostr->buffer_size = 0;
+  iostr->buffer_request = 0;
+
+  return rc;
+}
+
+
 /**
  * raptor_iostream_write_byte:
  * @byte: byte to write
@@ -709,6 +803,9 @@ raptor_free_iostream(raptor_iostream *iostr)
  *
  * Write a byte to the iostream.
  *
+ * If the iostream is buffered, the byte is stored and passed on to
+ * the handler when the buffer fills or the iostream is flushed.
+ *
  * Return value: non-0 on failure
  **/
 int
@@ -716,6 +813,14 @@ raptor_iostream_write_byte(const int byte, raptor_iostream *iostr)
 {
   iostr->offset++;
 
+  if(raptor_iostream_alloc_buffer(iostr)) {
+    if(iostr->buffer_length == iostr->buffer_size &&
+       raptor_iostream_flush_buffer(iostr))
+      return 1;
+    iostr->buffer[iostr->buffer_length++] = (unsigned char)byte;
+    return 0;
+  }
+
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return 1;
   if(!iostr->handler->write_byte)
@@ -735,6 +840,10 @@ raptor_iostream_write_byte(const int byte, raptor_iostream *iostr)
  *
  * Write bytes to the iostream.
  *
+ * If the iostream is buffered, writes that fit in the buffer are
+ * stored there and all objects are counted as written; failures are
+ * then reported when the buffer is flushed.
+ *
  * Return value: number of objects actually written, which may be less than nmemb. <0 on failure
  **/
 int
@@ -743,6 +852,23 @@ raptor_iostream_write_bytes(const void *ptr, size_t size, size_t nmemb,
 {
   int nobj;
   
+  if(raptor_iostream_alloc_buffer(iostr)) {
+    size_t len = size * nmemb;
+
+    if(len > iostr->buffer_size - iostr->buffer_length) {
+      if(raptor_iostream_flush_buffer(iostr))
+        return -1;
+    }
+
+    if(len <= iostr->buffer_size - iostr->buffer_length) {
+      memcpy(iostr->buffer + iostr->buffer_length, ptr, len);
+      iostr->buffer_length += len;
+      iostr->offset += len;
+      return RAPTOR_BAD_CAST(int, nmemb);
+    }
+    /* larger than the buffer: pass straight to the handler */
+  }
+
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return -1;
   if(!iostr->handler->write_bytes)
@@ -817,6 +943,8 @@ raptor_uri_write(raptor_uri* uri, raptor_iostream* iostr)
  *
  * End writing to the iostream.
  *
+ * Any buffered bytes are passed to the handler first.
+ *
  * Return value: non-0 on failure
  **/
 int
@@ -826,14 +954,58 @@ raptor_iostream_write_end(raptor_iostream *iostr)
   
   if(iostr->flags & RAPTOR_IOSTREAM_FLAGS_EOF)
     return 1;
-  if(iostr->handler->write_end)
-    rc = iostr->handler->write_end(iostr->user_data);
+  rc = raptor_iostream_free_buffer(iostr);
+  if(iostr->handler->write_end && iostr->handler->write_end(iostr->user_data))
+    rc = 1;
   iostr->flags |= RAPTOR_IOSTREAM_FLAGS_EOF;
 
   return rc;
 }
 
 
+/**
+ * raptor_iostream_flush:
+ * @iostr: raptor iostream
+ *
+ * Pass any buffered bytes to the iostream handler.
+ *
+ * This does not flush any buffering done by the handler itself, such
+ * as that of a stdio FILE*.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_iostream_flush(raptor_iostream *iostr)
+{
+  return raptor_iostream_flush_buffer(iostr);
+}
+
+
+/**
+ * raptor_iostream_set_write_buffer_size:
+ * @iostr: raptor iostream
+ * @size: buffer size in bytes or 0 to write unbuffered
+ *
+ * Set the size of the iostream write buffer.
+ *
+ * Bytes already buffered are passed to the handler first and the new
+ * buffer is allocated at the next write.  By default iostreams
+ * writing to a filename or string are buffered and those writing to
+ * a FILE* handle or using a user handler are not.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_iostream_set_write_buffer_size(raptor_iostream *iostr, size_t size)
+{
+  int rc = raptor_iostream_free_buffer(iostr);
+
+  iostr->buffer_request = size;
+
+  return rc;
+}
+
+
 /**
  * raptor_stringbuffer_write:
  * @sb: #raptor_stringbuffer to write
@@ -1248,6 +1420,62 @@ test_write_to_file_handle(raptor_world *world, FILE* handle,
 }
 
 
+/* writes to a FILE* iostream and to the FILE* itself stay in order */
+static int
+test_write_to_file_handle_order(raptor_world *world)
+{
+  raptor_iostream *iostr = NULL;
+  FILE *handle;
+  char buffer[32];
+  size_t len;
+  int rc = 0;
+  const char* const expected = "firstsecondthird";
+  const char* const label="write iostream to file handle in order";
+
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
+  fprintf(stderr, "%s: Testing %s\n", program, label);
+#endif
+
+  handle = tmpfile();
+  if(!handle) {
+    fprintf(stderr, "%s: Failed to create temporary file for %s\n",
+            program, label);
+    return 1;
+  }
+
+  iostr = raptor_new_iostream_to_file_handle(world, handle);
+  if(!iostr) {
+    fprintf(stderr, "%s: Failed to create %s\n", program, label);
+    rc = 1;
+    goto tidy;
+  }
+
+  raptor_iostream_string_write("first", iostr);
+  fputs("second", handle);
+  raptor_iostream_string_write("third", iostr);
+
+  /* read back before the iostream is freed */
+  rewind(handle);
+  len = fread(buffer, 1, sizeof(buffer) - 1, handle);
+  buffer[len] = '\0';
+  if(strcmp(buffer, expected)) {
+    fprintf(stderr, "%s: %s wrote '%s', expected '%s'\n", program, label,
+            buffer, expected);
+    rc = 1;
+  }
+
+  tidy:
+  if(iostr)
+    raptor_free_iostream(iostr);
+  fclose(handle);
+
+  if(rc)
+    fprintf(stderr, "%s: FAILED Testing %s\n", program, label);
+
+  return rc;
+}
+
+
 static int
 test_write_to_string(raptor_world *world,
                      const char* test_string, size_t test_string_len,
@@ -1350,6 +1578,81 @@ test_write_to_sink(raptor_world *world,
 }
 
 
+static int
+test_write_buffered(raptor_world *world, size_t buffer_size,
+                    const char* test_string, size_t test_string_len)
+{
+  raptor_iostream *iostr = NULL;
+  unsigned long count;
+  int rc = 0;
+  void *string = NULL;
+  size_t string_len;
+  size_t i;
+  const size_t expected_len = 2 * (test_string_len + 1);
+  const char* const label="write buffered iostream to a string";
+
+#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
+  fprintf(stderr, "%s: Testing %s with buffer size %d\n", program, label,
+          (int)buffer_size);
+#endif
+
+  iostr = raptor_new_iostream_to_string(world, &string, &string_len, NULL);
+  if(!iostr) {
+    fprintf(stderr, "%s: Failed to create %s\n", program, label);
+    return 1;
+  }
+
+  if(raptor_iostream_set_write_buffer_size(iostr, buffer_size)) {
+    fprintf(stderr, "%s: %s failed to set buffer size %d\n", program, label,
+            (int)buffer_size);
+    rc = 1;
+  }
+
+  /* once as a block, once in pieces through the inlined writes */
+  raptor_iostream_write_bytes(test_string, 1, test_string_len, iostr);
+  raptor_iostream_write_byte('\n', iostr);
+  raptor_iostream_put_counted_string(test_string, 5, iostr);
+  for(i = 5; i < test_string_len; i++)
+    raptor_iostream_put_byte(test_string[i], iostr);
+  raptor_iostream_string_write("\n", iostr);
+
+  count = raptor_iostream_tell(iostr);
+  if(count != expected_len) {
+    fprintf(stderr, "%s: %s wrote %d bytes, expected %d\n", program, label,
+            (int)count, (int)expected_len);
+    rc = 1;
+  }
+
+  if(raptor_iostream_flush(iostr)) {
+    fprintf(stderr, "%s: %s failed to flush\n", program, label);
+    rc = 1;
+  }
+
+  raptor_free_iostream(iostr);
+
+  if(!string) {
+    fprintf(stderr, "%s: %s failed to create a string\n", program, label);
+    return 1;
+  }
+  if(string_len != expected_len ||
+     strncmp((const char*)string, test_string, test_string_len) ||
+     strncmp((const char*)string + test_string_len + 1, test_string,
+             test_string_len)) {
+    fprintf(stderr, "%s: %s created string '%s', expected '%s' twice\n",
+            program, label, (const char*)string, test_string);
+    rc = 1;
+  }
+
+  raptor_free_memory(string);
+
+  if(rc)
+    fprintf(stderr, "%s: FAILED Testing %s with buffer size %d\n", program,
+            label, (int)buffer_size);
+
+  return rc;
+}
+
+
 static int
 test_read_from_filename(raptor_world *world,
                         const char* filename, 
@@ -1603,6 +1906,7 @@ main(int argc, char *argv[])
     fclose(handle);
     remove(OUT_FILENAME);
   }
+  failures+= test_write_to_file_handle_order(world);
   
   failures+= test_write_to_string(world,
                                   TEST_STRING,
@@ -1610,6 +1914,9 @@ main(int argc, char *argv[])
   failures+= test_write_to_sink(world,
                                 TEST_STRING,
                                 TEST_STRING_LEN, (int)OUT_BYTES_COUNT);
+  failures+= test_write_buffered(world, 0, TEST_STRING, TEST_STRING_LEN);
+  failures+= test_write_buffered(world, 4, TEST_STRING, TEST_STRING_LEN);
+  failures+= test_write_buffered(world, 1024, TEST_STRING, TEST_STRING_LEN);
 
   remove(OUT_FILENAME);
 
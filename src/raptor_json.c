@@ -110,6 +110,9 @@ struct raptor_json_parser_context_s {
 
   /* Temporary storage, while creating statements */
   raptor_statement statement;
+
+  /* recently used URI and blank node terms */
+  raptor_term_cache term_cache;
 };
 
 typedef struct raptor_json_parser_context_s raptor_json_parser_context;
@@ -150,23 +153,23 @@ raptor_json_cstring_from_counted_string(raptor_parser *rdf_parser, const unsigne
 static raptor_term*
 raptor_json_new_term_from_counted_string(raptor_parser *rdf_parser, const unsigned char* str, size_t len)
 {
+  raptor_json_parser_context *context = (raptor_json_parser_context*)rdf_parser->context;
   raptor_term *term = NULL;
 
   if(len > 2 && str[0] == '_' && str[1] == ':') {
     const unsigned char *node_id = &str[2];
-    term = raptor_new_term_from_counted_blank(rdf_parser->world, node_id, len - 2);
+    term = raptor_term_cache_get_blank(&context->term_cache, rdf_parser->world,
+                                       node_id, len - 2);
 
   } else {
-    raptor_uri *uri = raptor_new_uri_from_counted_string(rdf_parser->world, str, len);
-    if(!uri) {
+    term = raptor_term_cache_get_uri(&context->term_cache, rdf_parser->world,
+                                     str, len);
+    if(!term) {
       unsigned char* cstr = raptor_json_cstring_from_counted_string(rdf_parser, str, RAPTOR_BAD_CAST(int, len));
       raptor_parser_error(rdf_parser, "Could not create uri from '%s'", cstr);
       RAPTOR_FREE(char*, cstr);
       return NULL;
     }
-
-    term = raptor_new_term_from_uri(rdf_parser->world, uri);
-    raptor_free_uri(uri);
   }
 
   return term;
@@ -186,13 +189,13 @@ raptor_json_generate_term(raptor_parser *rdf_parser)
 
   switch(context->term_type) {
     case RAPTOR_TERM_TYPE_URI: {
-      raptor_uri *uri = raptor_new_uri(rdf_parser->world, context->term_value);
-      if(!uri) {
+      term = raptor_term_cache_get_uri(&context->term_cache, rdf_parser->world,
+                                       context->term_value,
+                                       strlen((const char*)context->term_value));
+      if(!term) {
         raptor_parser_error(rdf_parser, "Could not create uri from '%s'", context->term_value);
         return NULL;
       }
-      term = raptor_new_term_from_uri(rdf_parser->world, uri);
-      raptor_free_uri(uri);
       break;
     }
     case RAPTOR_TERM_TYPE_LITERAL: {
@@ -210,7 +213,9 @@ raptor_json_generate_term(raptor_parser *rdf_parser)
       if(strlen((const char*)node_id) > 2 && node_id[0] == '_' && node_id[1] == ':') {
           node_id = &node_id[2];
       }
-      term = raptor_new_term_from_blank(rdf_parser->world, node_id);
+      term = raptor_term_cache_get_blank(&context->term_cache,
+                                         rdf_parser->world, node_id,
+                                         strlen((const char*)node_id));
       break;
     }
     case RAPTOR_TERM_TYPE_UNKNOWN:
@@ -411,7 +416,7 @@ static int raptor_json_yajl_end_map(void * ctx)
       return 0;
 
     /* Generate the statement */
-    (*rdf_parser->statement_handler)(rdf_parser->user_data, &context->statement);
+    raptor_parser_emit_statement(rdf_parser, &context->statement);
 
     raptor_free_term(context->statement.object);
     context->statement.object = NULL;
@@ -465,7 +470,7 @@ static int raptor_json_yajl_end_map(void * ctx)
       return 0;
     } else {
       /* Generate the statement */
-      (*rdf_parser->statement_handler)(rdf_parser->user_data, &context->statement);
+      raptor_parser_emit_statement(rdf_parser, &context->statement);
     }
     raptor_statement_clear(&context->statement);
     context->state = RAPTOR_JSON_STATE_TRIPLES_ARRAY;
@@ -604,6 +609,7 @@ raptor_json_parse_terminate(raptor_parser* rdf_parser)
 
   raptor_json_reset_term(context);
   raptor_statement_clear(&context->statement);
+  raptor_term_cache_clear(&context->term_cache);
 }
 
 
@@ -153,17 +153,17 @@ raptor_json_writer_quoted(raptor_json_writer* json_writer,
   int rc = 0;
   
   if(!value) {
-    raptor_iostream_counted_string_write("\"\"", 2, json_writer->iostr);
+    raptor_iostream_put_counted_string("\"\"", 2, json_writer->iostr);
     return 0;
   }
   if(!value_len)
     value_len = strlen((const char*)value);
 
-  raptor_iostream_write_byte('\"', json_writer->iostr);
+  raptor_iostream_put_byte('\"', json_writer->iostr);
   rc = raptor_string_python_write((const unsigned char*)value, value_len,
                                   '"', 3,
                                   json_writer->iostr);
-  raptor_iostream_write_byte('\"', json_writer->iostr);
+  raptor_iostream_put_byte('\"', json_writer->iostr);
 
   return rc;
 }
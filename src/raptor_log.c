@@ -130,13 +130,21 @@ raptor_log_error(raptor_world* world, raptor_log_level level,
                  raptor_locator* locator, const char* text)
 {
   raptor_log_handler handler;
+  raptor_log_message* message = &world->message;
+#ifdef RAPTOR_WORLD_THREADS
+  raptor_log_message thread_message;
+
+  /* threads sharing a world each log into their own message */
+  if(world->thread_safe)
+    message = &thread_message;
+#endif
   
-  memset(&world->message, '\0', sizeof(&world->message));
-  world->message.code = -1;
-  world->message.domain = RAPTOR_DOMAIN_NONE;
-  world->message.level = level;
-  world->message.locator = locator;
-  world->message.text = text;
+  memset(message, '\0', sizeof(*message));
+  message->code = -1;
+  message->domain = RAPTOR_DOMAIN_NONE;
+  message->level = level;
+  message->locator = locator;
+  message->text = text;
   
   if(level == RAPTOR_LOG_LEVEL_NONE)
     return;
@@ -149,7 +157,7 @@ raptor_log_error(raptor_world* world, raptor_log_level level,
     /* This is the place in raptor that ALL of the user error handler
      * functions are called.
      */
-    handler(world->message_handler_user_data, &world->message);
+    handler(world->message_handler_user_data, message);
   else {
     if(locator) {
       raptor_locator_print(locator, stderr);
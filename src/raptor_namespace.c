@@ -152,6 +152,8 @@ raptor_namespaces_init(raptor_world* world,
 
   nstack->def_namespace = NULL;
 
+  nstack->name_cache = NULL;
+
   nstack->rdf_ms_uri = raptor_new_uri_from_counted_string(nstack->world,
                                                           (const unsigned char*)raptor_rdf_namespace_uri,
                                                           raptor_rdf_namespace_uri_len);
@@ -316,6 +318,19 @@ raptor_namespaces_clear(raptor_namespace_stack *nstack)
     nstack->table_size = 0;
   }
 
+  if(nstack->name_cache) {
+    int i;
+
+    for(i = 0; i < RAPTOR_NAMESPACE_NAME_CACHE_SIZE; i++) {
+      if(nstack->name_cache[i].ns_uri) {
+        raptor_free_uri(nstack->name_cache[i].ns_uri);
+        raptor_free_uri(nstack->name_cache[i].uri);
+      }
+    }
+    RAPTOR_FREE(raptor_namespace_name_cache_entry_array, nstack->name_cache);
+    nstack->name_cache = NULL;
+  }
+
   if(nstack->world) {
     if(nstack->rdf_ms_uri) {
       raptor_free_uri(nstack->rdf_ms_uri);
@@ -468,6 +483,78 @@ raptor_namespaces_find_namespace_by_uri(raptor_namespace_stack *nstack,
 }
 
 
+/**
+ * raptor_namespace_local_name_to_uri:
+ * @ns: namespace on a namespace stack
+ * @local_name: local name
+ * @local_name_length: length of @local_name
+ *
+ * INTERNAL - Get the URI for a local name in a namespace
+ *
+ * Names are resolved through a cache on the namespace stack of @ns
+ * so that a name seen before costs one cache probe and returns a
+ * reference to the same interned URI.  Entries are keyed on the
+ * namespace URI object, whose reference they hold, rather than the
+ * namespace, so they stay valid as namespaces start and end and are
+ * shared by re-declarations of the same namespace.
+ *
+ * Return value: new reference to the URI or NULL on failure or if
+ * the namespace has no URI
+ */
+raptor_uri*
+raptor_namespace_local_name_to_uri(const raptor_namespace* ns,
+                                   const unsigned char* local_name,
+                                   unsigned int local_name_length)
+{
+  raptor_namespace_stack* nstack = ns->nstack;
+  raptor_namespace_name_cache_entry* entry;
+  raptor_uri* uri;
+  unsigned int hash;
+
+  if(!ns->uri)
+    return NULL;
+
+  if(!nstack->name_cache) {
+    nstack->name_cache = RAPTOR_CALLOC(raptor_namespace_name_cache_entry*,
+                                       RAPTOR_NAMESPACE_NAME_CACHE_SIZE,
+                                       sizeof(raptor_namespace_name_cache_entry));
+    if(!nstack->name_cache)
+      return raptor_new_uri_from_uri_local_name(nstack->world, ns->uri,
+                                                local_name);
+  }
+
+  hash = raptor_hash_ns_string(local_name, RAPTOR_BAD_CAST(int, local_name_length));
+  hash ^= RAPTOR_GOOD_CAST(unsigned int, ((size_t)ns->uri) >> 4);
+  entry = &nstack->name_cache[hash & (RAPTOR_NAMESPACE_NAME_CACHE_SIZE - 1)];
+
+  if(entry->ns_uri == ns->uri) {
+    size_t ns_uri_len;
+    size_t uri_len;
+    const unsigned char* uri_string;
+
+    /* the cached URI is the namespace URI followed by the local name */
+    raptor_uri_as_counted_string(ns->uri, &ns_uri_len);
+    uri_string = raptor_uri_as_counted_string(entry->uri, &uri_len);
+    if(uri_len == ns_uri_len + local_name_length &&
+       !memcmp(uri_string + ns_uri_len, local_name, local_name_length))
+      return raptor_uri_copy(entry->uri);
+  }
+
+  uri = raptor_new_uri_from_uri_local_name(nstack->world, ns->uri, local_name);
+  if(!uri)
+    return NULL;
+
+  if(entry->ns_uri) {
+    raptor_free_uri(entry->ns_uri);
+    raptor_free_uri(entry->uri);
+  }
+  entry->ns_uri = raptor_uri_copy(ns->uri);
+  entry->uri = raptor_uri_copy(uri);
+
+  return uri;
+}
+
+
 /**
  * raptor_namespaces_namespace_in_scope:
  * @nstack: namespace stack
@@ -1081,6 +1168,7 @@ main(int argc, char *argv[])
   const char *program = raptor_basename(argv[0]);
   raptor_namespace_stack namespaces; /* static */
   raptor_namespace* ns;
+  raptor_uri *uri1, *uri2, *uri3;
 
   world = raptor_new_world();
   if(!world || raptor_world_open(world))
@@ -1123,10 +1211,41 @@ main(int argc, char *argv[])
     return(1);
   }
 
+  /* names resolved twice give the same URI; others do not */
+  uri1 = raptor_qname_string_to_uri(&namespaces, (const unsigned char*)"ex2:foo", 7);
+  uri2 = raptor_qname_string_to_uri(&namespaces, (const unsigned char*)"ex2:foo", 7);
+  uri3 = raptor_qname_string_to_uri(&namespaces, (const unsigned char*)"ex2:fo", 6);
+  if(!uri1 || uri1 != uri2 || !uri3 || uri3 == uri1 ||
+     strcmp((const char*)raptor_uri_as_string(uri1), "http://example.org/ns2foo") ||
+     strcmp((const char*)raptor_uri_as_string(uri3), "http://example.org/ns2fo")) {
+    fprintf(stderr, "%s: resolving ex2:foo and ex2:fo gave wrong URIs\n",
+            program);
+    return(1);
+  }
+  raptor_free_uri(uri1);
+  raptor_free_uri(uri2);
+  raptor_free_uri(uri3);
+
   raptor_namespaces_end_for_depth(&namespaces, 2);
 
   raptor_namespaces_end_for_depth(&namespaces, 1);
 
+  /* a re-declared prefix resolves to its new namespace */
+  raptor_namespaces_start_namespace_full(&namespaces,
+                                         (const unsigned char*)"ex2",
+                                         (const unsigned char*)"http://example.org/other",
+                                         1);
+  uri1 = raptor_qname_string_to_uri(&namespaces, (const unsigned char*)"ex2:foo", 7);
+  if(!uri1 ||
+     strcmp((const char*)raptor_uri_as_string(uri1), "http://example.org/otherfoo")) {
+    fprintf(stderr, "%s: resolving ex2:foo after re-declaring ex2 gave wrong URI\n",
+            program);
+    return(1);
+  }
+  raptor_free_uri(uri1);
+
+  raptor_namespaces_end_for_depth(&namespaces, 1);
+
   raptor_namespaces_end_for_depth(&namespaces, 0);
 
   raptor_namespaces_clear(&namespaces);
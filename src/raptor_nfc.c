@@ -96,85 +96,97 @@ raptor_nfc_check_combiners(u16 base, u16 follow)
 
 
 
-static int
-raptor_nfc_get_class(unsigned long key)
-{
-  int low = 0;
-  int high = RAPTOR_NFC_CLASSES_COUNT;
-
-  while(low < high) {
-    int middle = (low+high)/2;
-    unsigned int middle_key = raptor_nfc_classes[middle].key;
-
-    /* found class */
-    if(key == middle_key)
-      return raptor_nfc_classes[middle].combining_class;
-
-    /* otherwise need to binary search further */
-    if(key < middle_key)
-      high = middle;
-    else
-      low = middle+1;
-  }
-
-  return raptor_nfc_classes[low].combining_class;
-}
+/* Properties for codes outside the ranges covered by the trie */
+static const raptor_nfc_props raptor_nfc_simp_props = { simp, 0 };
+static const raptor_nfc_props raptor_nfc_nono_props = { NoNo, 0 };
+static const raptor_nfc_props raptor_nfc_nofc_props = { NOFC, 0 };
 
 
-static RAPTOR_INLINE raptor_nfc_code_flag
-raptor_nfc_get_code_flag (unsigned long c)
+static RAPTOR_INLINE const raptor_nfc_props*
+raptor_nfc_get_props(unsigned long c)
 {
-  if(c < 0x10900)  {
-    /* U+0 to U+108FF - from flags table (first 0x10900 entries) */
-    if(c & 1)
-      return (raptor_nfc_code_flag)(raptor_nfc_flags[c>>1] & 0xF);
-    else
-      return (raptor_nfc_code_flag)(raptor_nfc_flags[c>>1] >>4);
-  } else if(c < 0x1D000)
+  if(c < 0x10900)
+    /* U+0 to U+108FF - from trie (first 0x10900 entries) */
+    ;
+  else if(c < 0x1D000)
     /* U+10900 to U+1CFFF - codes do not exist */
-    return NoNo;
-  else if(c < 0x1D800) {
-    /* U+1D000 to U+1D7FF - from flags table (after first 0x10900) */
+    return &raptor_nfc_nono_props;
+  else if(c < 0x1D800)
+    /* U+1D000 to U+1D7FF - from trie (after first 0x10900) */
     c -= (0x1D000-0x10900);
-    if(c & 1)
-      return (raptor_nfc_code_flag)(raptor_nfc_flags[c>>1] & 0xF);
-    else
-      return (raptor_nfc_code_flag)(raptor_nfc_flags[c>>1] >>4);
-  } else if(c < 0x20000)
+  else if(c < 0x20000)
     /* U+1D800 to U+1FFFF - codes do not exist */
-    return NoNo;
+    return &raptor_nfc_nono_props;
   else if(c < 0x2A6D7)
     /* U+20000 to U+2A6D6 - CJK Ideograph Extension B  - simple */
-    return simp;
+    return &raptor_nfc_simp_props;
   else if(c < 0x2F800)
     /* U+2A6D8 to U+2F7FF - codes do not exist */
-    return NoNo;
+    return &raptor_nfc_nono_props;
   else if(c < 0x2FA1E)
     /* U+2F800 to U+2FA1D - CJK Compatibility Ideographs Supplement - forbidden/excluded in NFC */
     /* FIXME Unicode 4 says to 2FA1F */
-    return NOFC;
+    return &raptor_nfc_nofc_props;
   else if(c == 0xE0001)
     /* U+E0001 - "Language Tag" - simple */
-    return simp;
+    return &raptor_nfc_simp_props;
   else if(c < 0xE0020)
     /* U+E0002 to U+E001F - codes do not exist */
-    return NoNo;
+    return &raptor_nfc_nono_props;
   else if(c < 0xE0080)
     /* U+E0020 to U+E007F - Tag components - simple */
-    return simp;
+    return &raptor_nfc_simp_props;
   else if(c < 0xE0100)
     /* U+E0080 to U+E00FF - codes do not exist */
-    return NoNo;
+    return &raptor_nfc_nono_props;
   else if(c < 0xE01F0)
     /* U+E0100 to U+E01EF - Variation Selectors Supplement - simple */
-    return simp;
+    return &raptor_nfc_simp_props;
   else
     /* otherwise does not exist/forbidden */
-    return NoNo;
+    return &raptor_nfc_nono_props;
+
+  return &raptor_nfc_trie_props[raptor_nfc_trie_leaves[raptor_nfc_trie_index[c >> RAPTOR_NFC_TRIE_SHIFT]][c & (RAPTOR_NFC_TRIE_BLOCK_SIZE - 1)]];
 }
 
 
 
+/*
+ * raptor_nfc_get_char - Decode a UTF-8 character
+ *
+ * Decodes well-formed 2 and 3 byte sequences (most scripts) inline and
+ * hands anything else to raptor_unicode_utf8_string_get_char() so the
+ * result is always the same as calling that.
+ */
+static RAPTOR_INLINE int
+raptor_nfc_get_char(const unsigned char *string, size_t len,
+                    raptor_unichar *unichar)
+{
+  unsigned char c = *string;
+
+  if(c >= 0xC2 && c < 0xE0) {
+    if(len > 1 && (string[1] & 0xC0) == 0x80) {
+      *unichar = (RAPTOR_GOOD_CAST(raptor_unichar, c & 0x1F) << 6) |
+                 (string[1] & 0x3F);
+      return 2;
+    }
+  } else if(c >= 0xE0 && c < 0xF0) {
+    if(len > 2 && (string[1] & 0xC0) == 0x80 && (string[2] & 0xC0) == 0x80) {
+      raptor_unichar u = (RAPTOR_GOOD_CAST(raptor_unichar, c & 0x0F) << 12) |
+                         (RAPTOR_GOOD_CAST(raptor_unichar, string[1] & 0x3F) << 6) |
+                         (string[2] & 0x3F);
+      /* not overlong, a surrogate, U+FFFE or U+FFFF */
+      if(u >= 0x800 && (u < 0xD800 || u > 0xDFFF) && u < 0xFFFE) {
+        *unichar = u;
+        return 3;
+      }
+    }
+  }
+
+  return raptor_unicode_utf8_string_get_char(string, len, unichar);
+}
+
+
 #ifdef RAPTOR_DEBUG_NFC_CHECK
 #define RAPTOR_NFC_CHECK_FAIL(char, reason) do { fprintf(stderr, "%s:%d:%s: NFC check failed on U+%04lX: " reason "\n", __FILE__, __LINE__, __func__, char); } while(0)
 #else
@@ -209,13 +221,35 @@ raptor_nfc_check(const unsigned char* string, size_t len, int *error)
   offset = 0;
   prev_class = 0;
 
-  while(offset < len) {
+  while(len > 0) {
     raptor_unichar unichar;
     int unichar_len;
     int combining_class = 0;
     raptor_nfc_code_flag flag;
+    const raptor_nfc_props* props;
+
+    if(*string < 0x80) {
+      /* A run of US-ASCII is all class 0 Base or simp characters that
+       * need no checks; only the last one matters for what follows
+       * and its flag is never compared to anything but Hangul flags.
+       */
+      size_t ascii_len = 1;
+
+      if(len > 1 && string[1] < 0x80)
+        ascii_len = raptor_unicode_utf8_ascii_span(string, len);
+
+      string += ascii_len;
+      offset += ascii_len;
+      len -= ascii_len;
+
+      prev_char = string[-1];
+      prev_char_flag = simp;
+      prev_class = 0;
+      is_start = 0;
+      continue;
+    }
     
-    unichar_len = raptor_unicode_utf8_string_get_char(string, len, &unichar);
+    unichar_len = raptor_nfc_get_char(string, len, &unichar);
     if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > len) {
       /* UTF-8 encoding had an error or ended in the middle of a string */
       if(error)
@@ -228,7 +262,8 @@ raptor_nfc_check(const unsigned char* string, size_t len, int *error)
     
     len -= unichar_len;
 
-    flag = raptor_nfc_get_code_flag(unichar);
+    props = raptor_nfc_get_props(unichar);
+    flag = (raptor_nfc_code_flag)props->flag;
 
     switch (flag) {
       case HIGH:
@@ -267,7 +302,7 @@ raptor_nfc_check(const unsigned char* string, size_t len, int *error)
           RAPTOR_NFC_CHECK_FAIL(unichar, "ReCo at start");
           return 0;
         }
-        combining_class = raptor_nfc_get_class(unichar);
+        combining_class = props->combining_class;
 
         /* check 1 - previous class later than current, always an error */
         if(prev_class > combining_class) {
@@ -306,7 +341,7 @@ raptor_nfc_check(const unsigned char* string, size_t len, int *error)
           return 0;
         }
 
-        combining_class = raptor_nfc_get_class(unichar);
+        combining_class = props->combining_class;
         if(prev_class > combining_class) {
           if(error)
             *error = RAPTOR_BAD_CAST(int, offset);
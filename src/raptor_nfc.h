@@ -114,3 +114,35 @@ extern const raptor_nfc_base_follow raptor_nfc_recombiners[RAPTOR_NFC_RECOMBINER
 
 #define RAPTOR_NFC_CODE_FLAGS_COUNT 34944
 extern const u8 raptor_nfc_flags[RAPTOR_NFC_CODE_FLAGS_COUNT];
+
+
+/*
+ * Code flag and combining class of a code
+ */
+typedef struct
+{
+  /* raptor_nfc_code_flag */
+  u8 flag;
+  /* the combining class (0 unless flag is ReCo or NoRe) */
+  u8 combining_class;
+} raptor_nfc_props;
+
+
+/* Two-level trie giving the raptor_nfc_props for codes U+0 to U+108FF,
+ * U+1D000 to U+1D7FF, indexed in the same way as raptor_nfc_flags.
+ *
+ * The top bits of the index select a leaf number from
+ * raptor_nfc_trie_index, the low RAPTOR_NFC_TRIE_SHIFT bits select an
+ * entry in that leaf which is an index into raptor_nfc_trie_props.
+ */
+#define RAPTOR_NFC_TRIE_SHIFT 5
+#define RAPTOR_NFC_TRIE_BLOCK_SIZE (1 << RAPTOR_NFC_TRIE_SHIFT)
+
+#define RAPTOR_NFC_PROPS_COUNT 71
+extern const raptor_nfc_props raptor_nfc_trie_props[RAPTOR_NFC_PROPS_COUNT];
+
+#define RAPTOR_NFC_TRIE_INDEX_COUNT 2184
+extern const u8 raptor_nfc_trie_index[RAPTOR_NFC_TRIE_INDEX_COUNT];
+
+#define RAPTOR_NFC_TRIE_LEAVES_COUNT 243
+extern const u8 raptor_nfc_trie_leaves[RAPTOR_NFC_TRIE_LEAVES_COUNT][RAPTOR_NFC_TRIE_BLOCK_SIZE];
@@ -26,6 +26,10 @@
 
 /* END QUOTE */
 
+/* The trie tables at the end of this file are generated from the
+ * tables above by scripts/gen-nfc-trie.pl
+ */
+
 /* pairs of (key, class) in a sparse sequence ordered by key */
 const raptor_nfc_key_class raptor_nfc_classes[RAPTOR_NFC_CLASSES_COUNT] = {
     {0x00300, 230},  {0x00301, 230},  {0x00302, 230},  {0x00303, 230},
@@ -9411,3 +9415,798 @@ const u8 raptor_nfc_flags[RAPTOR_NFC_CODE_FLAGS_COUNT] = {
     /* U+1D7F8 */ simp*16+simp,  simp*16+simp,  simp*16+simp,  simp*16+simp,
 
   };
+
+
+/* Two-level trie over the code flags and combining classes above,
+ * derived from raptor_nfc_flags and raptor_nfc_classes by
+ * scripts/gen-nfc-trie.pl - regenerate it when those change.
+ * See raptor_nfc.h for the layout.
+ */
+
+/* Code flag and combining class pairs referenced by the trie leaves */
+const raptor_nfc_props raptor_nfc_trie_props[RAPTOR_NFC_PROPS_COUNT] = {
+    {simp,   0},  {Base,   0},  {NoNo,   0},  {ReCo, 230},  {NoRe, 230},
+    {NoRe, 232},  {NoRe, 220},  {ReCo, 216},  {NoRe, 202},  {ReCo, 220},
+    {ReCo, 202},  {NoRe,   1},  {ReCo,   1},  {NOFC,   0},  {ReCo, 240},
+    {NoRe, 234},  {NoRe, 233},  {NoRe, 222},  {NoRe, 228},  {NoRe,  10},
+    {NoRe,  11},  {NoRe,  12},  {NoRe,  13},  {ReCo,  14},  {NoRe,  15},
+    {NoRe,  16},  {NoRe,  17},  {NoRe,  18},  {NoRe,  19},  {NoRe,  20},
+    {NoRe,  21},  {NoRe,  22},  {NoRe,  23},  {NoRe,  24},  {NoRe,  25},
+    {NoRe,  27},  {NoRe,  28},  {NoRe,  29},  {NoRe,  30},  {NoRe,  31},
+    {NoRe,  32},  {NoRe,  33},  {NoRe,  34},  {NoRe,  35},  {NoRe,  36},
+    {ReCo,   7},  {NoRe,   9},  {NoRe,   7},  {COM0,   0},  {NoRe,  84},
+    {ReCo,  91},  {ReCo,   9},  {NoRe, 103},  {NoRe, 107},  {NoRe, 118},
+    {NoRe, 122},  {NoRe, 216},  {NoRe, 129},  {NoRe, 130},  {NoRe, 132},
+    {Hang,   0},  {hAng,   0},  {haNG,   0},  {NoRe, 218},  {NoRe, 224},
+    {ReCo,   8},  {HAng,   0},  {HIGH,   0},  {loww,   0},  {NoRe,  26},
+    {NoRe, 226}
+};
+
+
+/* Leaf number for each block of RAPTOR_NFC_TRIE_BLOCK_SIZE codes */
+const u8 raptor_nfc_trie_index[RAPTOR_NFC_TRIE_INDEX_COUNT] = {
+    /* U+0000 */   0,   1,   2,   2,   0,   3,   4,   5,
+    /* U+0100 */   6,   7,   8,   9,   0,  10,  11,  12,
+    /* U+0200 */  13,  14,  15,   0,  16,   0,   0,   0,
+    /* U+0300 */  17,  18,  19,  20,  21,  22,  23,  24,
+    /* U+0400 */  25,  26,  27,  28,  29,   0,  30,  31,
+    /* U+0500 */  32,  33,  34,  35,  36,  37,  38,  39,
+    /* U+0600 */  40,  41,  42,  43,   0,   0,  44,  45,
+    /* U+0700 */  46,  47,  48,  49,   0,  50,  49,  49,
+    /* U+0800 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+0900 */  35,  51,  52,  53,  54,  55,  56,  57,
+    /* U+0A00 */  58,  59,  60,  61,  62,  63,  64,  65,
+    /* U+0B00 */  54,  66,  67,  68,  69,  70,  71,  72,
+    /* U+0C00 */  73,  74,  75,  76,  77,  78,  79,  76,
+    /* U+0D00 */  77,  80,  81,  76,  82,  83,  84,  85,
+    /* U+0E00 */  35,  86,  87,  49,  88,  89,  90,  49,
+    /* U+0F00 */  91,  92,  93,  94,  95,  96,  97,  49,
+    /* U+1000 */   0,  98,  99,  49,  49,   0, 100, 101,
+    /* U+1100 */ 102,   0, 103, 104,   0, 105, 106,  99,
+    /* U+1200 */ 107,   0, 108,   0, 109, 110, 111, 112,
+    /* U+1300 */ 110,   0, 113, 114,  49,   0,   0, 115,
+    /* U+1400 */  35,   0,   0,   0,   0,   0,   0,   0,
+    /* U+1500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+1600 */   0,   0,   0, 116, 117,   0,   0,  53,
+    /* U+1700 */ 118, 119, 120, 121,   0,   0, 122, 123,
+    /* U+1800 */ 124,   0,   0, 125,   0, 126,  49,  49,
+    /* U+1900 */ 117, 127, 128, 129,  49,  49,  49,   0,
+    /* U+1A00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+1B00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+1C00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+1D00 */   0,   0,   0, 130,  49,  49,  49,  49,
+    /* U+1E00 */ 131, 132, 133, 134, 135, 136, 136, 137,
+    /* U+1F00 */ 138, 139, 140, 141, 142, 143, 144, 145,
+    /* U+2000 */ 146,   0, 147, 148, 149,  50, 150, 151,
+    /* U+2100 */   0, 152, 153,   0, 154,   0, 155,   0,
+    /* U+2200 */ 156, 157, 158, 159, 160, 161,   0,   0,
+    /* U+2300 */   0, 162,   0,   0,   0,   0,  53,  49,
+    /* U+2400 */   0, 163, 164,   0,   0,   0,   0,   0,
+    /* U+2500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+2600 */ 165,   0,   0, 166,  50, 167,  49,  49,
+    /* U+2700 */ 168, 169, 170,  35, 171, 172,  15, 173,
+    /* U+2800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+2900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+2A00 */   0,   0,   0,   0,   0,   0, 174,   0,
+    /* U+2B00 */ 175,  49,  49,  49,  49,  49,  49,  49,
+    /* U+2C00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+2D00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+2E00 */  49,  49,  49,  49, 176,   0,   0, 120,
+    /* U+2F00 */   0,   0,   0,   0,   0,   0, 177, 178,
+    /* U+3000 */   0, 179, 180, 181, 182, 183, 181, 184,
+    /* U+3100 */ 185, 186,   0,   0, 112, 125,  49,  15,
+    /* U+3200 */ 187,   0, 188, 189,   0,   0,   0, 187,
+    /* U+3300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+3F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4D00 */   0,   0,   0,   0,   0, 177,   0,   0,
+    /* U+4E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+4F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+5F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+6F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+7F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+8F00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9400 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9500 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9600 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9700 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9800 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9900 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9A00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9B00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9C00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9D00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9E00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+9F00 */   0,   0,   0,   0,   0, 190,  49,  49,
+    /* U+A000 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+A100 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+A200 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+A300 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+A400 */   0,   0,   0,   0, 191,   0, 163,  49,
+    /* U+A500 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+A600 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+A700 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+A800 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+A900 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+AA00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+AB00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+AC00 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+AD00 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+AE00 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+AF00 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+B000 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+B100 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+B200 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+B300 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+B400 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+B500 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+B600 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+B700 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+B800 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+B900 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+BA00 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+BB00 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+BC00 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+BD00 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+BE00 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+BF00 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+C000 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+C100 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+C200 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+C300 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+C400 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+C500 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+C600 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+C700 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+C800 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+C900 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+CA00 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+CB00 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+CC00 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+CD00 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+CE00 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+CF00 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+D000 */ 193, 194, 195, 196, 197, 198, 192, 193,
+    /* U+D100 */ 194, 195, 196, 197, 198, 192, 193, 194,
+    /* U+D200 */ 195, 196, 197, 198, 192, 193, 194, 195,
+    /* U+D300 */ 196, 197, 198, 192, 193, 194, 195, 196,
+    /* U+D400 */ 197, 198, 192, 193, 194, 195, 196, 197,
+    /* U+D500 */ 198, 192, 193, 194, 195, 196, 197, 198,
+    /* U+D600 */ 192, 193, 194, 195, 196, 197, 198, 192,
+    /* U+D700 */ 193, 194, 195, 196, 197, 199,  49,  49,
+    /* U+D800 */ 200, 200, 200, 200, 200, 200, 200, 200,
+    /* U+D900 */ 200, 200, 200, 200, 200, 200, 200, 200,
+    /* U+DA00 */ 200, 200, 200, 200, 200, 200, 200, 200,
+    /* U+DB00 */ 200, 200, 200, 200, 200, 200, 200, 200,
+    /* U+DC00 */ 201, 201, 201, 201, 201, 201, 201, 201,
+    /* U+DD00 */ 201, 201, 201, 201, 201, 201, 201, 201,
+    /* U+DE00 */ 201, 201, 201, 201, 201, 201, 201, 201,
+    /* U+DF00 */ 201, 201, 201, 201, 201, 201, 201, 201,
+    /* U+E000 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E100 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E200 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E300 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E400 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E500 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E600 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E700 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E800 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+E900 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+EA00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+EB00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+EC00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+ED00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+EE00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+EF00 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F000 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F100 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F200 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F300 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F400 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F500 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F600 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F700 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F800 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+F900 */ 202, 202, 202, 202, 202, 202, 202, 202,
+    /* U+FA00 */ 203, 204, 202, 205,  49,  49,  49,  49,
+    /* U+FB00 */ 206, 207, 208,   0,   0,  50, 209,   0,
+    /* U+FC00 */   0,   0,   0,   0,   0,   0,   0,   0,
+    /* U+FD00 */   0,   0,  15,   0, 210,   0, 211, 212,
+    /* U+FE00 */  32, 213, 214, 215,   0,   0,   0, 216,
+    /* U+FF00 */  35,   0,   0,   0,   0, 187, 217, 218,
+    /* U+10000 */ 219, 220, 221,  49,   0,   0,   0, 222,
+    /* U+10100 */ 223, 224,  49,  49,  49,  49,  49,  49,
+    /* U+10200 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+10300 */ 187, 188, 164,  49, 189,  49,  49,  49,
+    /* U+10400 */   0,   0,   0,   0, 166, 225,  49,  49,
+    /* U+10500 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+10600 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+10700 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+10800 */ 226, 227,  49,  49,  49,  49,  49,  49,
+    /* U+1D000 */   0,   0,   0,   0,   0,   0,   0, 177,
+    /* U+1D100 */   0, 228, 229, 230, 231, 232, 233,  49,
+    /* U+1D200 */  49,  49,  49,  49,  49,  49,  49,  49,
+    /* U+1D300 */   0,   0, 116,  49,  49,  49,  49,  49,
+    /* U+1D400 */   0,   0, 234,   0, 235, 236, 237,   0,
+    /* U+1D500 */ 238, 239, 240,   0,   0,   0,   0,   0,
+    /* U+1D600 */   0,   0,   0,   0,   0, 241,   0,   0,
+    /* U+1D700 */   0,   0,   0,   0,   0,   0, 242,   0
+};
+
+
+/* Index of raptor_nfc_trie_props for each code in a block */
+const u8 raptor_nfc_trie_leaves[RAPTOR_NFC_TRIE_LEAVES_COUNT][RAPTOR_NFC_TRIE_BLOCK_SIZE] = {
+    /*   0 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   1 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,  0},
+    /*   2 */ { 0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0},
+    /*   3 */ { 0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*   4 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               0,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  0,  0},
+    /*   5 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               0,  1,  1,  1,  1,  1,  1,  0,  1,  1,  1,  1,  1,  1,  0,  1},
+    /*   6 */ { 1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               0,  0,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1},
+    /*   7 */ { 1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,
+               1,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  0},
+    /*   8 */ { 0,  0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  1,  1,  1,  1,
+               1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0},
+    /*   9 */ { 1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+    /*  10 */ { 1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+               1,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  11 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  1,
+               1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  1,  1},
+    /*  12 */ { 1,  1,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,
+               0,  0,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  0,  0,  0,  0},
+    /*  13 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1},
+    /*  14 */ { 0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  15 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  16 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  17 */ { 3,  3,  3,  3,  3,  4,  3,  3,  3,  3,  3,  3,  3,  4,  4,  3,
+               4,  3,  4,  3,  3,  5,  6,  6,  6,  6,  5,  7,  6,  6,  6,  6},
+    /*  18 */ { 6,  8,  8,  9,  9,  9,  9, 10, 10,  6,  6,  6,  6,  9,  9,  6,
+               9,  9,  6,  6, 11, 11, 11, 11, 12,  6,  6,  6,  6,  4,  4,  4},
+    /*  19 */ {13, 13,  3, 13, 13, 14,  4,  6,  6,  6,  4,  4,  4,  6,  6,  0,
+               4,  4,  4,  6,  6,  6,  6,  4,  2,  2,  2,  2,  2, 15, 15, 16},
+    /*  20 */ {15, 15, 16,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+               2,  2,  2,  2, 13,  0,  2,  2,  2,  2,  0,  2,  2,  2, 13,  2},
+    /*  21 */ { 2,  2,  2,  2,  0,  0,  0, 13,  0,  0,  0,  2,  0,  2,  0,  0,
+               0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  1},
+    /*  22 */ { 0,  1,  2,  0,  0,  1,  0,  0,  0,  1,  0,  0,  1,  0,  1,  0,
+               0,  1,  0,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  1},
+    /*  23 */ { 0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  1,  1,  0,  0,  1,  2,
+               0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  24 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2},
+    /*  25 */ { 0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               1,  0,  0,  1,  0,  1,  1,  1,  1,  0,  1,  0,  0,  0,  1,  0},
+    /*  26 */ { 0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  1,  0,  0,
+               1,  0,  0,  1,  0,  1,  1,  1,  1,  0,  1,  0,  0,  0,  1,  0},
+    /*  27 */ { 0,  0,  0,  1,  0,  0,  0,  1,  0,  0,  0,  1,  0,  1,  0,  0,
+               0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  28 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  29 */ { 0,  0,  0,  4,  4,  4,  4,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  30 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0},
+    /*  31 */ { 0,  0,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  2,  2,  2,  2,  2,  2},
+    /*  32 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  33 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  34 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0},
+    /*  35 */ { 2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  36 */ { 0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  2,  2,  2,  2,  2,
+               2,  6,  4,  4,  4,  4,  6,  4,  4,  4, 17,  6,  4,  4,  4,  4},
+    /*  37 */ { 4,  4,  2,  6,  6,  6,  6,  6,  4,  4,  6,  4,  4, 17, 18,  4,
+              19, 20, 21, 22, 23, 24, 25, 26, 27, 28,  2, 29, 30, 31,  0, 32},
+    /*  38 */ { 0, 33, 34,  0,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0},
+    /*  39 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  40 */ { 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,
+               4,  4,  4,  4,  4,  4,  2,  2,  2,  2,  2,  0,  2,  2,  2,  0},
+    /*  41 */ { 2,  0,  1,  1,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2},
+    /*  42 */ { 0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  1, 35, 36, 37, 38, 39,
+              40, 41, 42,  3,  3,  9,  6,  4,  4,  2,  2,  2,  2,  2,  2,  2},
+    /*  43 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+              43,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  44 */ { 0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  1,  0,  0,  1,  4,  4,  4,  4,  4,  4,  4,  0,  0,  4},
+    /*  45 */ { 4,  4,  4,  6,  4,  0,  0,  4,  4,  0,  6,  4,  4,  6,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  46 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+               0, 44,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  47 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               4,  6,  4,  4,  6,  4,  4,  6,  6,  6,  4,  6,  6,  4,  6,  4},
+    /*  48 */ { 4,  4,  6,  4,  6,  4,  6,  4,  6,  4,  4,  2,  2,  0,  0,  0,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  49 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  50 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  51 */ { 0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,
+               1,  0,  0,  1,  0,  0,  0,  0,  0,  0,  2,  2, 45,  0,  0,  0},
+    /*  52 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,  2,  2,
+               0,  4,  6,  4,  4,  2,  2,  2, 13, 13, 13, 13, 13, 13, 13, 13},
+    /*  53 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  54 */ { 2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,
+               0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  55 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  2,  0,  2,  2,  2,  0,  0,  0,  0,  2,  2, 47,  0, 48,  0},
+    /*  56 */ { 0,  0,  0,  0,  0,  2,  2,  1,  0,  2,  2,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2,  2,  2, 48,  2,  2,  2,  2, 13, 13,  2, 13},
+    /*  57 */ { 0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2},
+    /*  58 */ { 2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  0,
+               0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  59 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  2,  0, 13,  2,  0, 13,  2,  0,  0,  2,  2, 47,  2,  0,  0},
+    /*  60 */ { 0,  0,  0,  2,  2,  2,  2,  0,  0,  2,  2,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2, 13, 13, 13,  0,  2, 13,  2},
+    /*  61 */ { 2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  62 */ { 2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,
+               0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  63 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  2,  0,  0,  2,  0,  0,  0,  0,  0,  2,  2, 47,  0,  0,  0},
+    /*  64 */ { 0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  2,  0,  0, 46,  2,  2,
+               0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  65 */ { 0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               2,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  66 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  2,  0,  0,  2,  0,  0,  0,  0,  0,  2,  2, 47,  0, 48,  0},
+    /*  67 */ { 0,  0,  0,  0,  2,  2,  2,  1,  0,  2,  2,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2,  2, 48, 48,  2,  2,  2,  2, 13, 13,  2,  0},
+    /*  68 */ { 0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  69 */ { 2,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  0,
+               0,  2,  1,  0,  0,  0,  2,  2,  2,  0,  0,  2,  0,  2,  0,  0},
+    /*  70 */ { 2,  2,  2,  0,  0,  2,  2,  2,  0,  0,  0,  2,  2,  2,  0,  0,
+               0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  2,  2,  2,  2, 48,  0},
+    /*  71 */ { 0,  0,  0,  2,  2,  2,  1,  1,  0,  2,  0,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2,  2,  2, 48,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  72 */ { 2,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2},
+    /*  73 */ { 2,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+               0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  74 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0},
+    /*  75 */ { 0,  0,  0,  0,  0,  2,  1,  0,  0,  2,  0,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2, 49, 50,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  76 */ { 0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  77 */ { 2,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+               0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /*  78 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  2,  2, 47,  0,  0,  1},
+    /*  79 */ { 0,  0, 48,  0,  0,  2,  1,  0,  0,  2,  1,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2, 48, 48,  2,  2,  2,  2,  2,  2,  2,  0,  2},
+    /*  80 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2, 48,  0},
+    /*  81 */ { 0,  0,  0,  0,  2,  2,  1,  1,  0,  2,  0,  0,  0, 46,  2,  2,
+               2,  2,  2,  2,  2,  2,  2, 48,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  82 */ { 2,  2,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0},
+    /*  83 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  2},
+    /*  84 */ { 0,  0,  0,  0,  0,  0,  0,  2,  2,  2, 51,  2,  2,  2,  2, 48,
+               0,  0,  0,  0,  0,  2,  0,  2,  0,  1,  0,  0,  1,  0,  0, 48},
+    /*  85 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  86 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0, 52, 52, 46,  2,  2,  2,  2,  0},
+    /*  87 */ { 0,  0,  0,  0,  0,  0,  0,  0, 53, 53, 53, 53,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2},
+    /*  88 */ { 2,  0,  0,  2,  0,  2,  2,  0,  0,  2,  0,  2,  2,  0,  2,  2,
+               2,  2,  2,  2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+    /*  89 */ { 2,  0,  0,  0,  2,  0,  2,  0,  2,  2,  0,  0,  2,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0, 54, 54,  2,  0,  0,  0,  2,  2},
+    /*  90 */ { 0,  0,  0,  0,  0,  2,  0,  2, 55, 55, 55, 55,  0,  0,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  2,  2},
+    /*  91 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  0,  0,  0,  0,  0,  0},
+    /*  92 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  6,  0,  6,  0, 56,  0,  0,  0,  0,  0,  0},
+    /*  93 */ { 0,  0,  0, 13,  0,  0,  0,  0,  2,  0,  0,  0,  0, 13,  0,  0,
+               0,  0, 13,  0,  0,  0,  0, 13,  0,  0,  0,  0, 13,  0,  0,  0},
+    /*  94 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  2,  2,  2,  2,  2,
+               2, 57, 58, 13, 59, 13, 13,  0, 13,  0, 58, 58, 58, 58,  0,  0},
+    /*  95 */ {58, 13,  4,  4, 46,  0,  4,  4,  0,  0,  0,  0,  2,  2,  2,  2,
+               0,  0,  0, 13,  0,  0,  0,  0,  2,  0,  0,  0,  0, 13,  0,  0},
+    /*  96 */ { 0,  0, 13,  0,  0,  0,  0, 13,  0,  0,  0,  0, 13,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0,  2,  0,  0},
+    /*  97 */ { 0,  0,  0,  0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  2,  2,  0,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /*  98 */ { 0,  0,  2,  0,  0,  1,  0,  0,  2,  0,  0,  2,  0,  0, 48,  0,
+               0,  0,  0,  2,  2,  2,  0, 47,  0, 46,  2,  2,  2,  2,  2,  2},
+    /*  99 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2},
+    /* 100 */ { 0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 101 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  2,  2},
+    /* 102 */ {60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60, 60,
+              60, 60, 60,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 103 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  0},
+    /* 104 */ { 0, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
+              61, 61, 61, 61, 61, 61,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 105 */ { 0,  0,  0,  2,  2,  2,  2,  2, 62, 62, 62, 62, 62, 62, 62, 62,
+              62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62, 62},
+    /* 106 */ {62, 62, 62,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 107 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 108 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,  0,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,  0,  2,  2},
+    /* 109 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0,  0,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 110 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+               0,  2,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  2},
+    /* 111 */ { 0,  2,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  2,
+               0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 112 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 113 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2},
+    /* 114 */ { 2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2},
+    /* 115 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 116 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 117 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2},
+    /* 118 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+               0,  0,  0,  0, 46,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 119 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0, 46,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 120 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 121 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,
+               0,  2,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 122 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0, 46,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  2,  2},
+    /* 123 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2},
+    /* 124 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2},
+    /* 125 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 126 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0, 18,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 127 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0, 17,  4,  6,  2,  2,  2,  2},
+    /* 128 */ { 0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 129 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,
+               0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 130 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 131 */ { 1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,
+               0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0},
+    /* 132 */ { 1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+    /* 133 */ { 1,  1,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  0,  0,  0,  0,  1,  1,  1,  1,  1,  1,  1,  1},
+    /* 134 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  0,  0},
+    /* 135 */ { 1,  1,  1,  1,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  1,  1,
+               1,  1,  0,  0,  0,  0,  1,  1,  1,  1,  0,  0,  2,  2,  2,  2},
+    /* 136 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+    /* 137 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  1,  1,  0,  0,  1,  1,  1,  1,  2,  2,  2,  2,  2,  2},
+    /* 138 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  0,  0,  0,  0,  2,  2,  1,  1,  0,  0,  0,  0,  2,  2},
+    /* 139 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0},
+    /* 140 */ { 1,  1,  0,  0,  0,  0,  2,  2,  1,  1,  0,  0,  0,  0,  2,  2,
+               1,  1,  0,  0,  0,  0,  0,  0,  2,  1,  2,  0,  2,  0,  2,  0},
+    /* 141 */ { 1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+               1, 13,  0, 13,  1, 13,  0, 13,  0, 13,  0, 13,  1, 13,  2,  2},
+    /* 142 */ { 1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+               1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0},
+    /* 143 */ { 1,  1,  0,  0,  0,  0,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  1,  0,  2,  1,  0,  0,  0,  0, 13,  1,  0, 13,  1},
+    /* 144 */ { 0,  0,  0,  1,  0,  2,  1,  0,  0, 13,  0, 13,  1,  0,  0,  0,
+               0,  0,  0, 13,  2,  2,  0,  0,  0,  0,  0, 13,  2,  0,  0,  0},
+    /* 145 */ { 0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0, 13, 13,
+               2,  2,  0,  1,  0,  2,  1,  0,  0, 13,  0, 13,  1, 13,  1,  2},
+    /* 146 */ {13, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 147 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  2,  0,  2,  2,  2,  2,  2,  2,  2,  0},
+    /* 148 */ { 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 149 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 150 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               4,  4, 11, 11,  4,  4,  4,  4, 11, 11, 11,  4,  4,  0,  0,  0},
+    /* 151 */ { 0,  4,  0,  0,  0, 11, 11,  4,  6,  4, 11,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 152 */ { 0,  0,  0,  0,  0,  0, 13,  0,  0,  0, 13, 13,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0},
+    /* 153 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,
+               2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 154 */ { 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 155 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 156 */ { 0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,  1,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 157 */ { 0,  0,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0},
+    /* 158 */ { 0,  0,  0,  1,  0,  1,  0,  0,  1,  0,  0,  0,  0,  1,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 159 */ { 0,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  1,  1,  1,  1,  0,  0},
+    /* 160 */ { 0,  0,  1,  1,  0,  0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 161 */ { 0,  0,  1,  0,  0,  0,  0,  0,  1,  1,  0,  1,  0,  0,  0,  0,
+               0,  0,  1,  1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 162 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 13,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 163 */ { 0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 164 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 165 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0},
+    /* 166 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2},
+    /* 167 */ { 0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 168 */ { 2,  0,  0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 169 */ { 0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 170 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,
+               0,  0,  0,  2,  2,  2,  0,  2,  0,  0,  0,  0,  0,  0,  0,  2},
+    /* 171 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 172 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2},
+    /* 173 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 174 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,  0,  0,  0},
+    /* 175 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 176 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0},
+    /* 177 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 178 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2},
+    /* 179 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 63, 18,  5, 17, 64, 64,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 180 */ { 2,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  1,
+               0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1},
+    /* 181 */ { 0,  1,  0,  0,  1,  0,  1,  0,  1,  0,  0,  0,  0,  0,  0,  1,
+               0,  0,  1,  0,  0,  1,  0,  0,  1,  0,  0,  1,  0,  0,  0,  0},
+    /* 182 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  2,  2, 65, 65,  0,  0,  1,  0,  0},
+    /* 183 */ { 0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  1,  0,  1,  0,  1,
+               0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1,  0,  1},
+    /* 184 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,
+               1,  1,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0},
+    /* 185 */ { 2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 186 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,
+               2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 187 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2},
+    /* 188 */ { 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 189 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0},
+    /* 190 */ { 0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 191 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 192 */ {66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0},
+    /* 193 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0},
+    /* 194 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 195 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+              66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 196 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 197 */ { 0,  0,  0,  0,  0,  0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 198 */ { 0,  0,  0,  0, 66,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 199 */ { 0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 200 */ {67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67,
+              67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67, 67},
+    /* 201 */ {68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+              68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68},
+    /* 202 */ {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+              13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+    /* 203 */ {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,  0,
+              13,  0, 13,  0,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0},
+    /* 204 */ {13,  0, 13,  0,  0, 13, 13,  0,  0,  0, 13, 13, 13, 13,  2,  2,
+              13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+    /* 205 */ {13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 206 */ { 0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  0, 69, 13},
+    /* 207 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 13, 13, 13, 13, 13,
+              13, 13, 13, 13, 13, 13, 13,  2, 13, 13, 13, 13, 13,  2, 13,  2},
+    /* 208 */ {13, 13,  2, 13, 13,  2, 13, 13, 13, 13, 13, 13, 13, 13, 13,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 209 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 210 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 211 */ { 0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 212 */ { 2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2},
+    /* 213 */ { 4,  4,  4,  4,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 214 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 215 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  2,  2,
+               0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 216 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  0},
+    /* 217 */ { 2,  2,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  0,  0,  0,
+               2,  2,  0,  0,  0,  0,  0,  0,  2,  2,  0,  0,  0,  2,  2,  2},
+    /* 218 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  0,  0,  0,  0,  0,  2,  2},
+    /* 219 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 220 */ { 0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  2,  0},
+    /* 221 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2},
+    /* 222 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2},
+    /* 223 */ { 0,  0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 224 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 225 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  2,  2,
+               2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2,  2},
+    /* 226 */ { 0,  0,  0,  0,  0,  0,  2,  2,  0,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 227 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  2,  0,  0,  2,  2,  2,  0,  2,  2,  0},
+    /* 228 */ { 0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 229 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 13},
+    /* 230 */ {13, 13, 13, 13, 13, 56, 56, 11, 11, 11,  0,  0,  0, 70, 56, 56,
+              56, 56, 56,  0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  6},
+    /* 231 */ { 6,  6,  6,  0,  0,  4,  4,  4,  4,  4,  6,  6,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 232 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  4,  4,  4,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13, 13, 13, 13, 13},
+    /* 233 */ {13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2},
+    /* 234 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 235 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0},
+    /* 236 */ { 2,  2,  0,  2,  2,  0,  0,  2,  2,  0,  0,  0,  0,  2,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  2,  0,  0,  0},
+    /* 237 */ { 0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 238 */ { 0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  2,  2,  0,  0,  0,
+               0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0},
+    /* 239 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  0,  0,  0,  0,  2},
+    /* 240 */ { 0,  0,  0,  0,  0,  2,  0,  2,  2,  2,  0,  0,  0,  0,  0,  0,
+               0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 241 */ { 0,  0,  0,  0,  2,  2,  2,  2,  0,  0,  0,  0,  0,  0,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+    /* 242 */ { 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  2,  2,  2,  2,  0,  0,
+               0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0}
+};
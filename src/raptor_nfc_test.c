@@ -45,6 +45,10 @@
 #include <string.h>
 #include <ctype.h> /* for isprint() */
 #include <stdarg.h>
+#ifdef HAVE_STDLIB_H
+#include <stdlib.h>
+#endif
+#include <time.h>
 #ifdef HAVE_ERRNO_H
 #include <errno.h>
 #endif
@@ -133,6 +137,75 @@ utf8_print(const unsigned char *input, int length, FILE *stream)
 }
 
 
+static const struct {
+  const char *label;
+  const char *text;
+} bench_texts[] = {
+  { "Latin-1",
+    "Fran\xc3\xa7ois M\xc3\xbcller, n\xc3\xa9 \xc3\xa0 Z\xc3\xbcrich, "
+    "\xc3\xa9tait un math\xc3\xa9maticien et \xc3\xa9" "crivain "
+    "su\xc3\xaf" "sse c\xc3\xa9l\xc3\xa8" "bre." },
+  { "Arabic",
+    "\xd8\xa7\xd9\x84\xd9\x82\xd8\xa7\xd9\x87\xd8\xb1\xd8\xa9 "
+    "\xd9\x87\xd9\x8a \xd8\xb9\xd8\xa7\xd8\xb5\xd9\x85\xd8\xa9 "
+    "\xd8\xac\xd9\x85\xd9\x87\xd9\x88\xd8\xb1\xd9\x8a\xd8\xa9 "
+    "\xd9\x85\xd8\xb5\xd8\xb1 "
+    "\xd8\xa7\xd9\x84\xd8\xb9\xd8\xb1\xd8\xa8\xd9\x8a\xd8\xa9" },
+  { "Arabic with harakat",
+    "\xd8\xa8\xd9\x90\xd8\xb3\xd9\x92\xd9\x85\xd9\x90 "
+    "\xd9\xb1\xd9\x84\xd9\x84\xd9\x8e\xd9\x91\xd9\x87\xd9\x90 "
+    "\xd9\xb1\xd9\x84\xd8\xb1\xd9\x8e\xd9\x91\xd8\xad\xd9\x92\xd9\x85"
+    "\xd9\x8e\xd9\xb0\xd9\x86\xd9\x90 "
+    "\xd9\xb1\xd9\x84\xd8\xb1\xd9\x8e\xd9\x91\xd8\xad\xd9\x90\xd9\x8a"
+    "\xd9\x85\xd9\x90" },
+  { "CJK",
+    "\xe6\x9d\xb1\xe4\xba\xac\xe9\x83\xbd\xe5\x8d\x83\xe4\xbb\xa3\xe7"
+    "\x94\xb0\xe5\x8c\xba\xe4\xb8\xb8\xe3\x81\xae\xe5\x86\x85\xe3\x81"
+    "\xaf\xe6\x97\xa5\xe6\x9c\xac\xe3\x81\xae\xe9\xa6\x96\xe9\x83\xbd"
+    "\xe3\x81\xa7\xe3\x81\x99" },
+  { NULL, NULL }
+};
+
+
+/*
+ * Time raptor_nfc_check() over Latin-1, Arabic and CJK text
+ */
+static int
+bench_nfc_check(const char *program, long iterations)
+{
+  int i;
+
+  if(iterations <= 0)
+    return 1;
+
+  for(i = 0; bench_texts[i].label; i++) {
+    const unsigned char *text = (const unsigned char*)bench_texts[i].text;
+    size_t len = strlen(bench_texts[i].text);
+    clock_t start;
+    double secs;
+    long n;
+    long passes = 0;
+
+    start = clock();
+    for(n = 0; n < iterations; n++)
+      passes += raptor_nfc_check(text, len, NULL);
+    secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    if(passes != iterations) {
+      fprintf(stderr, "%s: %s text failed NFC check\n", program,
+              bench_texts[i].label);
+      return 1;
+    }
+
+    fprintf(stderr, "%s: %-20s %3d bytes: %ld checks %.3fs, %.1fns per check\n",
+            program, bench_texts[i].label, (int)len, iterations,
+            secs, secs * 1e9 / iterations);
+  }
+
+  return 0;
+}
+
+
 int
 main (int argc, char *argv[]) 
 {
@@ -149,10 +222,15 @@ main (int argc, char *argv[])
   if(argc != 2) {
     fprintf(stderr,
             "USAGE %s [path to NormalizationTest.txt]\n"
-            "Get it at http://unicode.org/Public/UNIDATA/NormalizationTest.txt\n",
-            program);
+            "Get it at http://unicode.org/Public/UNIDATA/NormalizationTest.txt\n"
+            "   or %s ITERATIONS to run an NFC check benchmark\n",
+            program, program);
     return 1;
   }
+
+  /* raptor_nfc_test ITERATIONS runs an NFC check benchmark */
+  if(strspn(argv[1], "0123456789") == strlen(argv[1]))
+    return bench_nfc_check(program, atol(argv[1]));
   
   filename = argv[1];
   fh = fopen(filename, "r");
@@ -295,6 +295,36 @@ static const struct
     RAPTOR_OPTION_VALUE_TYPE_INT,
     "wwwSslVerifyHost",
     "SSL verify host matching"
+  },
+  { RAPTOR_OPTION_PARSE_ARENA,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "parseArena",
+    "N-Triples and N-Quads parsers allocate literals from an arena"
+  },
+  { RAPTOR_OPTION_PARSE_BORROW_TERMS,
+    RAPTOR_OPTION_AREA_PARSER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "parseBorrowTerms",
+    "N-Triples and N-Quads literals point into the input buffer"
+  },
+  { RAPTOR_OPTION_WRITER_XML_TRUST_UTF8,
+    (raptor_option_area)(RAPTOR_OPTION_AREA_SERIALIZER | RAPTOR_OPTION_AREA_XML_WRITER),
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "xmlTrustUTF8",
+    "Serializers and XML Writer do not check UTF-8 text is valid"
+  },
+  { RAPTOR_OPTION_SERIALIZE_MEMORY_LIMIT,
+    RAPTOR_OPTION_AREA_SERIALIZER,
+    RAPTOR_OPTION_VALUE_TYPE_INT,
+    "serializeMemoryLimit",
+    "Turtle serializer spills triples to temporary files over this many kilobytes"
+  },
+  { RAPTOR_OPTION_SERIALIZE_SORTED_INPUT,
+    RAPTOR_OPTION_AREA_SERIALIZER,
+    RAPTOR_OPTION_VALUE_TYPE_BOOL,
+    "serializeSortedInput",
+    "Grouping serializers write each subject as soon as the next one starts"
   }
 };
 
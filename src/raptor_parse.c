@@ -462,10 +462,18 @@ int
 raptor_parser_parse_chunk(raptor_parser* rdf_parser,
                           const unsigned char *buffer, size_t len, int is_end) 
 {
+  int rc;
+
   if(rdf_parser->sb)
     raptor_stringbuffer_append_counted_string(rdf_parser->sb, buffer, len, 1);
     
-  return rdf_parser->factory->chunk(rdf_parser, buffer, len, is_end);
+  rc = rdf_parser->factory->chunk(rdf_parser, buffer, len, is_end);
+
+  /* pass on any statements batched so far */
+  if(rc || is_end)
+    raptor_parser_flush_statement_batch(rdf_parser);
+
+  return rc;
 }
 
 
@@ -485,6 +493,17 @@ raptor_free_parser(raptor_parser* rdf_parser)
   if(rdf_parser->factory)
     rdf_parser->factory->terminate(rdf_parser);
 
+  /* any statements still batched are not passed on */
+  if(rdf_parser->statement_batch) {
+    int i;
+    for(i = 0; i < rdf_parser->statement_batch_count; i++)
+      raptor_statement_clear(&rdf_parser->statement_batch[i]);
+    RAPTOR_FREE(raptor_statement*, rdf_parser->statement_batch);
+  }
+
+  if(rdf_parser->term_arena)
+    raptor_free_term_arena(rdf_parser->term_arena);
+
   if(rdf_parser->www)
     raptor_free_www(rdf_parser->www);
 
@@ -933,6 +952,67 @@ raptor_parser_set_statement_handler(raptor_parser* parser,
 }
 
 
+/**
+ * raptor_parser_set_statement_batch_handler:
+ * @parser: #raptor_parser parser object
+ * @user_data: user data pointer for callback
+ * @handler: new batched statement callback function or NULL
+ * @batch_size: number of statements per call or <= 0 for the default
+ *
+ * Set the batched statement handler function for the parser.
+ *
+ * Use this to receive statements in arrays of up to @batch_size as
+ * the parsing proceeds, rather than one at a time with the handler
+ * set by raptor_parser_set_statement_handler(), which is not called
+ * while this handler is set.  Any statements left are passed on when
+ * a parse ends, and before any graph mark.
+ *
+ * The statements and their terms are valid until @handler returns;
+ * terms may be kept longer with raptor_term_copy(), which copies
+ * arena and borrowed terms to the heap.
+ *
+ * A NULL @handler returns to using the statement handler.
+ *
+ * Return value: non-0 on failure
+ **/
+int
+raptor_parser_set_statement_batch_handler(raptor_parser* parser,
+                                          void *user_data,
+                                          raptor_statement_batch_handler handler,
+                                          int batch_size)
+{
+  raptor_statement* batch = NULL;
+  int i;
+
+  /* pass on statements collected for any old handler */
+  raptor_parser_flush_statement_batch(parser);
+
+  if(handler) {
+    if(batch_size <= 0)
+      batch_size = RAPTOR_STATEMENT_BATCH_SIZE;
+
+    batch = RAPTOR_CALLOC(raptor_statement*, batch_size, sizeof(*batch));
+    if(!batch)
+      return 1;
+
+    for(i = 0; i < batch_size; i++)
+      raptor_statement_init(&batch[i], parser->world);
+  } else
+    batch_size = 0;
+
+  if(parser->statement_batch)
+    RAPTOR_FREE(raptor_statement*, parser->statement_batch);
+
+  parser->statement_batch_handler = handler;
+  parser->statement_batch_user_data = user_data;
+  parser->statement_batch = batch;
+  parser->statement_batch_size = batch_size;
+  parser->statement_batch_count = 0;
+
+  return 0;
+}
+
+
 /**
  * raptor_parser_set_graph_mark_handler:
  * @parser: #raptor_parser parser object
@@ -1386,6 +1466,10 @@ raptor_parser_copy_user_state(raptor_parser *to_parser,
   
   to_parser->user_data = from_parser->user_data;
   to_parser->statement_handler = from_parser->statement_handler;
+  rc = raptor_parser_set_statement_batch_handler(to_parser,
+                                                 from_parser->statement_batch_user_data,
+                                                 from_parser->statement_batch_handler,
+                                                 from_parser->statement_batch_size);
   to_parser->namespace_handler = from_parser->namespace_handler;
   to_parser->namespace_handler_user_data = from_parser->namespace_handler_user_data;
   to_parser->uri_filter = from_parser->uri_filter;
@@ -1586,6 +1670,108 @@ raptor_parser_get_content(raptor_parser* rdf_parser, size_t* length_p)
 }
 
 
+/*
+ * raptor_parser_get_term_arena:
+ * @parser: parser
+ *
+ * INTERNAL - Get the arena for the literal terms of the next statement
+ *
+ * The arena is only used if #RAPTOR_OPTION_PARSE_ARENA or
+ * #RAPTOR_OPTION_PARSE_BORROW_TERMS is set.  It is reset here when no
+ * batched statements hold terms from it, so a parser must call this
+ * before making the terms of each statement.
+ *
+ * Return value: arena or NULL if terms should be allocated normally
+ */
+raptor_term_arena*
+raptor_parser_get_term_arena(raptor_parser* parser)
+{
+  if(!RAPTOR_OPTIONS_GET_NUMERIC(parser, RAPTOR_OPTION_PARSE_ARENA) &&
+     !RAPTOR_OPTIONS_GET_NUMERIC(parser, RAPTOR_OPTION_PARSE_BORROW_TERMS))
+    return NULL;
+
+  if(!parser->term_arena) {
+    parser->term_arena = raptor_new_term_arena(parser->world);
+    return parser->term_arena;
+  }
+
+  if(!parser->statement_batch_count)
+    raptor_term_arena_reset(parser->term_arena);
+
+  return parser->term_arena;
+}
+
+
+/* reference a term for a batched statement; arena terms are kept
+ * as they are until the batch is handled */
+static raptor_term*
+raptor_parser_batch_term(raptor_term* term)
+{
+  if(term && term->usage < 0)
+    return term;
+
+  return raptor_term_copy(term);
+}
+
+
+/*
+ * raptor_parser_emit_statement:
+ * @parser: parser
+ * @statement: statement
+ *
+ * INTERNAL - Pass a statement to the user's statement or batch handler
+ *
+ * The statement remains owned by the caller.  Batched statements hold
+ * references to its heap terms and share its arena terms, which stay
+ * valid until the batch is handled.
+ */
+void
+raptor_parser_emit_statement(raptor_parser* parser,
+                             raptor_statement* statement)
+{
+  if(parser->statement_batch_handler) {
+    raptor_statement* s;
+
+    s = &parser->statement_batch[parser->statement_batch_count++];
+    s->subject = raptor_parser_batch_term(statement->subject);
+    s->predicate = raptor_parser_batch_term(statement->predicate);
+    s->object = raptor_parser_batch_term(statement->object);
+    s->graph = raptor_parser_batch_term(statement->graph);
+
+    if(parser->statement_batch_count == parser->statement_batch_size)
+      raptor_parser_flush_statement_batch(parser);
+    return;
+  }
+
+  if(parser->statement_handler)
+    (*parser->statement_handler)(parser->user_data, statement);
+}
+
+
+/*
+ * raptor_parser_flush_statement_batch:
+ * @parser: parser
+ *
+ * INTERNAL - Pass any batched statements to the user's batch handler
+ */
+void
+raptor_parser_flush_statement_batch(raptor_parser* parser)
+{
+  int i;
+
+  if(!parser->statement_batch_count)
+    return;
+
+  (*parser->statement_batch_handler)(parser->statement_batch_user_data,
+                                     parser->statement_batch,
+                                     parser->statement_batch_count);
+
+  for(i = 0; i < parser->statement_batch_count; i++)
+    raptor_statement_clear(&parser->statement_batch[i]);
+  parser->statement_batch_count = 0;
+}
+
+
 void 
 raptor_parser_start_graph(raptor_parser* parser, raptor_uri* uri,
                           int is_declared)
@@ -1597,8 +1783,10 @@ raptor_parser_start_graph(raptor_parser* parser, raptor_uri* uri,
   if(!parser->emit_graph_marks)
     return;
   
-  if(parser->graph_mark_handler)
+  if(parser->graph_mark_handler) {
+    raptor_parser_flush_statement_batch(parser);
     (*parser->graph_mark_handler)(parser->user_data, uri, flags);
+  }
 }
 
 
@@ -1612,8 +1800,10 @@ raptor_parser_end_graph(raptor_parser* parser, raptor_uri* uri, int is_declared)
   if(!parser->emit_graph_marks)
     return;
   
-  if(parser->graph_mark_handler)
+  if(parser->graph_mark_handler) {
+    raptor_parser_flush_statement_batch(parser);
     (*parser->graph_mark_handler)(parser->user_data, uri, flags);
+  }
 }
 
 
@@ -1702,6 +1892,55 @@ raptor_parser_parse_iostream(raptor_parser* rdf_parser, raptor_iostream *iostr,
 int main(int argc, char *argv[]);
 
 
+#ifdef RAPTOR_PARSER_NTRIPLES
+static const char *batch_test_content =
+  "<http://example.org/a> <http://example.org/p> \"1\" .\n"
+  "<http://example.org/a> <http://example.org/p> \"2\" .\n"
+  "<http://example.org/a> <http://example.org/p> \"3\" .\n"
+  "<http://example.org/a> <http://example.org/p> \"4\" .\n"
+  "<http://example.org/a> <http://example.org/p> \"5\" .\n";
+
+static int batch_test_calls = 0;
+static int batch_test_statements = 0;
+static int batch_test_errors = 0;
+
+static void
+batch_test_handler(void *user_data, raptor_statement *statements, int count)
+{
+  int i;
+
+  batch_test_calls++;
+  if(count > 2)
+    batch_test_errors++;
+
+  for(i = 0; i < count; i++) {
+    raptor_statement *s = &statements[i];
+    if(!s->subject || !s->predicate || !s->object ||
+       s->object->type != RAPTOR_TERM_TYPE_LITERAL ||
+       *s->object->value.literal.string != '1' + batch_test_statements)
+      batch_test_errors++;
+
+    /* keep copies of the statements if asked */
+    if(user_data)
+      ((raptor_statement**)user_data)[batch_test_statements] = raptor_statement_copy(s);
+
+    batch_test_statements++;
+  }
+}
+
+
+/* check literals are borrowed and keep copies of the statements */
+static void
+borrow_test_handler(void *user_data, raptor_statement *statement)
+{
+  if(statement->object->usage >= 0)
+    batch_test_errors++;
+
+  ((raptor_statement**)user_data)[batch_test_statements++] = raptor_statement_copy(statement);
+}
+#endif
+
+
 int
 main(int argc, char *argv[])
 {
@@ -1753,6 +1992,125 @@ main(int argc, char *argv[])
   }
   RAPTOR_FREE(char*, s);
 
+#ifdef RAPTOR_PARSER_NTRIPLES
+  if(1) {
+    raptor_parser* parser;
+    raptor_uri* base_uri;
+
+    parser = raptor_new_parser(world, "ntriples");
+    base_uri = raptor_new_uri(world, (const unsigned char*)"http://example.org/");
+    if(!parser || !base_uri ||
+       raptor_parser_set_statement_batch_handler(parser, NULL,
+                                                 batch_test_handler, 2) ||
+       raptor_parser_parse_start(parser, base_uri) ||
+       raptor_parser_parse_chunk(parser,
+                                 (const unsigned char*)batch_test_content,
+                                 strlen(batch_test_content), 1)) {
+      fprintf(stderr, "%s: batched parse failed\n", program);
+      return 1;
+    }
+
+    if(batch_test_calls != 3 || batch_test_statements != 5 ||
+       batch_test_errors) {
+      fprintf(stderr,
+              "%s: batch handler got %d statements in %d calls with %d errors, expected 5 in 3 calls\n",
+              program, batch_test_statements, batch_test_calls,
+              batch_test_errors);
+      return 1;
+    }
+
+    raptor_free_uri(base_uri);
+    raptor_free_parser(parser);
+  }
+
+  /* Literals from the parser's arena must survive copying */
+  if(1) {
+    raptor_parser* parser;
+    raptor_uri* base_uri;
+    raptor_statement* copies[5];
+
+    batch_test_calls = 0;
+    batch_test_statements = 0;
+    batch_test_errors = 0;
+
+    parser = raptor_new_parser(world, "ntriples");
+    base_uri = raptor_new_uri(world, (const unsigned char*)"http://example.org/");
+    if(!parser || !base_uri ||
+       raptor_parser_set_option(parser, RAPTOR_OPTION_PARSE_ARENA, NULL, 1) ||
+       raptor_parser_set_statement_batch_handler(parser, copies,
+                                                 batch_test_handler, 2) ||
+       raptor_parser_parse_start(parser, base_uri) ||
+       raptor_parser_parse_chunk(parser,
+                                 (const unsigned char*)batch_test_content,
+                                 strlen(batch_test_content), 1)) {
+      fprintf(stderr, "%s: arena parse failed\n", program);
+      return 1;
+    }
+    raptor_free_uri(base_uri);
+    raptor_free_parser(parser);
+
+    if(batch_test_statements != 5 || batch_test_errors) {
+      fprintf(stderr,
+              "%s: arena parse got %d statements with %d errors, expected 5\n",
+              program, batch_test_statements, batch_test_errors);
+      return 1;
+    }
+
+    for(i = 0; i < 5; i++) {
+      raptor_term* object = copies[i] ? copies[i]->object : NULL;
+
+      if(!object || object->usage < 1 ||
+         object->value.literal.string[0] != '1' + i ||
+         object->value.literal.string[1]) {
+        fprintf(stderr, "%s: arena statement %d copy is wrong\n", program, i);
+        return 1;
+      }
+      raptor_free_statement(copies[i]);
+    }
+
+    /* Borrowed literals must survive copying too */
+    batch_test_statements = 0;
+    batch_test_errors = 0;
+
+    parser = raptor_new_parser(world, "ntriples");
+    base_uri = raptor_new_uri(world, (const unsigned char*)"http://example.org/");
+    if(!parser || !base_uri ||
+       raptor_parser_set_option(parser, RAPTOR_OPTION_PARSE_BORROW_TERMS,
+                                NULL, 1))
+      return 1;
+    raptor_parser_set_statement_handler(parser, copies, borrow_test_handler);
+    if(raptor_parser_parse_start(parser, base_uri) ||
+       raptor_parser_parse_chunk(parser,
+                                 (const unsigned char*)batch_test_content,
+                                 strlen(batch_test_content), 1)) {
+      fprintf(stderr, "%s: borrowed terms parse failed\n", program);
+      return 1;
+    }
+    raptor_free_uri(base_uri);
+    raptor_free_parser(parser);
+
+    if(batch_test_statements != 5 || batch_test_errors) {
+      fprintf(stderr,
+              "%s: borrowed terms parse got %d statements with %d errors, expected 5\n",
+              program, batch_test_statements, batch_test_errors);
+      return 1;
+    }
+
+    for(i = 0; i < 5; i++) {
+      raptor_term* object = copies[i] ? copies[i]->object : NULL;
+
+      if(!object || object->usage < 1 ||
+         object->value.literal.string[0] != '1' + i ||
+         object->value.literal.string[1]) {
+        fprintf(stderr, "%s: borrowed statement %d copy is wrong\n",
+                program, i);
+        return 1;
+      }
+      raptor_free_statement(copies[i]);
+    }
+  }
+#endif
+
   raptor_free_world(world);
   
   return 0;
@@ -206,13 +206,9 @@ raptor_new_qname(raptor_namespace_stack *nstack,
   /* If namespace has a URI and a local_name is defined, create the URI
    * for this element 
    */
-  if(qname->nspace && local_name_length) {
-    raptor_uri *uri = raptor_namespace_get_uri(qname->nspace);
-    if(uri)
-      uri = raptor_new_uri_from_uri_local_name(qname->world, uri, new_name);
-
-    qname->uri = uri;
-  }
+  if(qname->nspace && local_name_length)
+    qname->uri = raptor_namespace_local_name_to_uri(qname->nspace, new_name,
+                                                    local_name_length);
 
 
   return qname;
@@ -283,11 +279,9 @@ raptor_new_qname_from_namespace_local_name(raptor_world* world,
 
   qname->nspace = ns;
 
-  if(qname->nspace) {
-    qname->uri = raptor_namespace_get_uri(qname->nspace);
-    if(qname->uri)
-      qname->uri = raptor_new_uri_from_uri_local_name(qname->world, qname->uri, new_name);
-  }
+  if(qname->nspace)
+    qname->uri = raptor_namespace_local_name_to_uri(qname->nspace, new_name,
+                                                    local_name_length);
   
   return qname;
 }
@@ -496,7 +490,8 @@ raptor_qname_string_to_uri(raptor_namespace_stack *nstack,
    */
   if(ns && (uri = raptor_namespace_get_uri(ns))) {
     if(local_name_length)
-      uri = raptor_new_uri_from_uri_local_name(nstack->world, uri, local_name);
+      uri = raptor_namespace_local_name_to_uri(ns, local_name,
+                                               local_name_length);
     else
       uri = raptor_uri_copy(uri);
   }
@@ -1211,11 +1211,11 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
     rdf_parser->emitted_default_graph++;
   }
 
-  if(!rdf_parser->statement_handler)
+  if(!rdf_parser->statement_handler && !rdf_parser->statement_batch_handler)
     goto generate_tidy;
 
   /* Generate the statement; or is it a fact? */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement(rdf_parser, statement);
 
 
   /* the bagID mess */
@@ -1245,15 +1245,8 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
     statement->predicate = bag_predicate_term;
 
     if(!reified_term || !reified_term->value.blank.string) {
-      unsigned char *reified_id = NULL;
-
       /* reified_term is NULL so generate a bag ID */
-      reified_id = raptor_world_generate_bnodeid(rdf_parser->world);
-      if(!reified_id)
-        goto generate_tidy;
-
-      reified_term = raptor_new_term_from_blank(rdf_parser->world, reified_id);
-      RAPTOR_FREE(char*, reified_id);
+      reified_term = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
       if(!reified_term)
         goto generate_tidy;
@@ -1261,7 +1254,7 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
     }
     
     statement->object = reified_term;
-    (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+    raptor_parser_emit_statement(rdf_parser, statement);
 
     if(bag_predicate_term)
       raptor_free_term(bag_predicate_term);
@@ -1278,23 +1271,23 @@ raptor_rdfxml_generate_statement(raptor_parser *rdf_parser,
   statement->subject = reified_term;
   statement->predicate = RAPTOR_RDF_type_term(rdf_parser->world);
   statement->object = RAPTOR_RDF_Statement_term(rdf_parser->world);
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement(rdf_parser, statement);
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_subject_term(rdf_parser->world);
   statement->object = subject_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement(rdf_parser, statement);
 
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_predicate_term(rdf_parser->world);
   statement->object = predicate_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement(rdf_parser, statement);
 
   /* statement->subject = reified_term; */
   statement->predicate = RAPTOR_RDF_object_term(rdf_parser->world);
   statement->object = object_term;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, statement);
+  raptor_parser_emit_statement(rdf_parser, statement);
 
 
  generate_tidy:
@@ -1778,15 +1771,8 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
             goto oom;
 
         } else if(element->rdf_attr[RDF_NS_nodeID]) {
-          unsigned char* subject_id;
-          subject_id = raptor_world_internal_generate_id(rdf_parser->world,
-                                                         (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
-          if(!subject_id)
-            goto oom;
-          
-          element->subject = raptor_new_term_from_blank(rdf_parser->world,
-                                                        subject_id);
-          RAPTOR_FREE(char*, subject_id);
+          element->subject = raptor_new_term_from_generated_blank(rdf_parser->world,
+                                                                  (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
 
           element->rdf_attr[RDF_NS_nodeID] = NULL;
           if(!element->subject)
@@ -1807,14 +1793,7 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
           /* copy from parent (property element), it has a URI for us */
           element->subject = raptor_term_copy(element->parent->object);
         } else {
-          unsigned char* subject_id;
-          subject_id = raptor_world_generate_bnodeid(rdf_parser->world);
-          if(!subject_id)
-            goto oom;
-
-          element->subject = raptor_new_term_from_blank(rdf_parser->world,
-                                                        subject_id);
-          RAPTOR_FREE(char*, subject_id);
+          element->subject = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
           if(!element->subject)
             goto oom;
@@ -2230,20 +2209,12 @@ raptor_rdfxml_start_element_grammar(raptor_parser *rdf_parser,
           if(!strcmp((char*)parse_type, "Literal"))
             is_parseType_Literal = 1;
           else if(!strcmp((char*)parse_type, "Resource")) {
-            unsigned char* subject_id;
-            
             state = RAPTOR_STATE_PARSETYPE_RESOURCE;
             element->child_state = RAPTOR_STATE_PROPERTYELT;
             element->child_content_type = RAPTOR_RDFXML_ELEMENT_CONTENT_TYPE_PROPERTIES;
 
             /* create a node for the subject of the contained properties */
-            subject_id = raptor_world_generate_bnodeid(rdf_parser->world);
-            if(!subject_id)
-              goto oom;
-
-            element->subject = raptor_new_term_from_blank(rdf_parser->world,
-                                                          subject_id);
-            RAPTOR_FREE(char*, subject_id);
+            element->subject = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
             if(!element->subject)
               goto oom;
@@ -2610,15 +2581,8 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                   goto oom;
                 element->content_type = RAPTOR_RDFXML_ELEMENT_CONTENT_TYPE_RESOURCE;
               } else if(element->rdf_attr[RDF_NS_nodeID]) {
-                unsigned char* resource_id;
-                resource_id = raptor_world_internal_generate_id(rdf_parser->world,
-                                                                (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
-                if(!resource_id)
-                  goto oom;
-                
-                element->object = raptor_new_term_from_blank(rdf_parser->world,
-                                                             resource_id);
-                RAPTOR_FREE(char*, resource_id);
+                element->object = raptor_new_term_from_generated_blank(rdf_parser->world,
+                                                                       (unsigned char*)element->rdf_attr[RDF_NS_nodeID]);
                 element->rdf_attr[RDF_NS_nodeID] = NULL;
                 if(!element->object)
                   goto oom;
@@ -2632,14 +2596,7 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
                   break;
                 }
               } else {
-                unsigned char* resource_id;
-                resource_id = raptor_world_generate_bnodeid(rdf_parser->world);
-                if(!resource_id)
-                  goto oom;
-                
-                element->object = raptor_new_term_from_blank(rdf_parser->world,
-                                                             resource_id);
-                RAPTOR_FREE(char*, resource_id);
+                element->object = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
                 if(!element->object)
                   goto oom;
@@ -2704,14 +2661,7 @@ raptor_rdfxml_end_element_grammar(raptor_parser *rdf_parser,
               if(element->content_type == RAPTOR_RDFXML_ELEMENT_CONTENT_TYPE_LITERAL &&
                  raptor_rdfxml_element_has_property_attributes(element) &&
                  !element->object) {
-                unsigned char* object_id;
-                object_id = raptor_world_generate_bnodeid(rdf_parser->world);
-                if(!object_id)
-                  goto oom;
-                
-                element->object = raptor_new_term_from_blank(rdf_parser->world,
-                                                             object_id);
-                RAPTOR_FREE(char*, object_id);
+                element->object = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
                 if(!element->object)
                   goto oom;
@@ -46,38 +46,23 @@
 
 #ifndef STANDALONE
 
-/**
- * raptor_new_uri_detail:
+/*
+ * raptor_uri_detail_scan:
  * @uri_string: The URI string to split
+ * @ud: detail to fill in
  *
- * Create a URI detailed structure from a URI string.
- * 
- **/
-raptor_uri_detail*
-raptor_new_uri_detail(const unsigned char *uri_string)
+ * INTERNAL - Split a URI string into its components without copying it
+ *
+ * The components in @ud point into @uri_string and are delimited
+ * only by their lengths; they are not NUL terminated and
+ * @ud->buffer is NULL.
+ */
+static void
+raptor_uri_detail_scan(const unsigned char *uri_string, raptor_uri_detail* ud)
 {
-  const unsigned char *s = NULL;
-  unsigned char *b = NULL;
-  raptor_uri_detail *ud;
-  size_t uri_len;
-
-  if(!uri_string)
-    return NULL;
-
-  uri_len = strlen((const char*)uri_string);
-
-  /* The extra +5 is for the 5 \0s that may be added for each component 
-   * even if the entire URI is empty 
-   */
-  ud = RAPTOR_CALLOC(raptor_uri_detail*, 1, sizeof(*ud) + uri_len + 5 + 1);
-  if(!ud)
-    return NULL;
-  ud->uri_len = uri_len;
-  ud->buffer = (unsigned char*)((unsigned char*)ud + sizeof(raptor_uri_detail));
-  
-  s = uri_string;
-  b = ud->buffer;
+  const unsigned char *s = uri_string;
 
+  memset(ud, 0, sizeof(*ud));
 
   /* Split the URI into it's syntactic components */
 
@@ -97,13 +82,8 @@ raptor_new_uri_detail(const unsigned char *uri_string)
   
     if(*s == ':') {
       /* it matches the URI scheme grammar, so store this as a scheme */
-      ud->scheme = b;
-      ud->scheme_len = s-uri_string;
-
-      while(*uri_string != ':')
-        *b++ = *uri_string++;
-      
-      *b++ = '\0';
+      ud->scheme = (unsigned char*)uri_string;
+      ud->scheme_len = s - uri_string;
 
       /* and move past the : */
       s++;
@@ -114,62 +94,132 @@ raptor_new_uri_detail(const unsigned char *uri_string)
 
   /* authority */
   if(*s && s[1] && *s == '/' && s[1] == '/') {
-    ud->authority = b;
-
     s += 2; /* skip "//" */
     
+    ud->authority = (unsigned char*)s;
     while(*s && *s != '/' && *s != '?' && *s != '#')
-      *b++ = *s++;
-    
-    ud->authority_len = b-ud->authority;
-    
-    *b++ = '\0';
+      s++;
+    ud->authority_len = s - ud->authority;
   }
 
 
   /* path */
   if(*s && *s != '?' && *s != '#') {
-    ud->path = b;
-    
+    ud->path = (unsigned char*)s;
     while(*s && *s != '?' && *s != '#')
-      *b++ = *s++;
-
-    ud->path_len = b-ud->path;
-    
-    *b++ = '\0';
+      s++;
+    ud->path_len = s - ud->path;
   }
 
 
   /* query */
   if(*s && *s == '?') {
-    ud->query = b;
-    
     s++;
     
+    ud->query = (unsigned char*)s;
     while(*s && *s != '#')
-      *b++ = *s++;
-    
-    ud->query_len = b-ud->query;
-    
-    *b++ = '\0';
+      s++;
+    ud->query_len = s - ud->query;
   }
 
   
   /* fragment identifier - RFC2396 Section 4.1 */
   if(*s && *s == '#') {
-    ud->fragment = b;
-    
     s++;
     
+    ud->fragment = (unsigned char*)s;
     while(*s)
-      *b++ = *s++;
-    
-    ud->fragment_len = b-ud->fragment;
-    
-    *b='\0';
+      s++;
+    ud->fragment_len = s - ud->fragment;
   }
 
+  ud->uri_len = s - uri_string;
   ud->is_hierarchical = (ud->path && *ud->path == '/');
+}
+
+
+/*
+ * raptor_uri_detail_copy_component:
+ * @buffer_p: pointer to buffer position
+ * @component: component
+ * @len: length of component
+ *
+ * INTERNAL - Copy a URI component into a detail buffer with a NUL
+ *
+ * Return value: the copied component
+ */
+static unsigned char*
+raptor_uri_detail_copy_component(unsigned char **buffer_p,
+                                 const unsigned char *component, size_t len)
+{
+  unsigned char *b = *buffer_p;
+
+  memcpy(b, component, len);
+  b[len] = '\0';
+  *buffer_p = b + len + 1;
+
+  return b;
+}
+
+
+/**
+ * raptor_new_uri_detail:
+ * @uri_string: The URI string to split
+ *
+ * Create a URI detailed structure from a URI string.
+ * 
+ **/
+raptor_uri_detail*
+raptor_new_uri_detail(const unsigned char *uri_string)
+{
+  raptor_uri_detail parts;
+  unsigned char *b = NULL;
+  raptor_uri_detail *ud;
+
+  if(!uri_string)
+    return NULL;
+
+  raptor_uri_detail_scan(uri_string, &parts);
+
+  /* The extra +5 is for the 5 \0s that may be added for each component 
+   * even if the entire URI is empty 
+   */
+  ud = RAPTOR_CALLOC(raptor_uri_detail*, 1,
+                     sizeof(*ud) + parts.uri_len + 5 + 1);
+  if(!ud)
+    return NULL;
+  ud->uri_len = parts.uri_len;
+  ud->buffer = (unsigned char*)((unsigned char*)ud + sizeof(raptor_uri_detail));
+  
+  b = ud->buffer;
+
+  if(parts.scheme) {
+    ud->scheme = raptor_uri_detail_copy_component(&b, parts.scheme,
+                                                  parts.scheme_len);
+    ud->scheme_len = parts.scheme_len;
+  }
+  if(parts.authority) {
+    ud->authority = raptor_uri_detail_copy_component(&b, parts.authority,
+                                                     parts.authority_len);
+    ud->authority_len = parts.authority_len;
+  }
+  if(parts.path) {
+    ud->path = raptor_uri_detail_copy_component(&b, parts.path,
+                                                parts.path_len);
+    ud->path_len = parts.path_len;
+  }
+  if(parts.query) {
+    ud->query = raptor_uri_detail_copy_component(&b, parts.query,
+                                                 parts.query_len);
+    ud->query_len = parts.query_len;
+  }
+  if(parts.fragment) {
+    ud->fragment = raptor_uri_detail_copy_component(&b, parts.fragment,
+                                                    parts.fragment_len);
+    ud->fragment_len = parts.fragment_len;
+  }
+
+  ud->is_hierarchical = parts.is_hierarchical;
 
   return ud;
 }
@@ -245,6 +295,37 @@ raptor_uri_detail_to_string(raptor_uri_detail *ud, size_t* len_p)
 }
 
 
+/*
+ * raptor_uri_path_has_dot_segments:
+ * @path: URI path
+ * @len: length of @path
+ *
+ * INTERNAL - Check if a path has any "." or ".." segments
+ *
+ * Return value: non-0 if the path has "." or ".." segments
+ */
+static int
+raptor_uri_path_has_dot_segments(const unsigned char *path, size_t len)
+{
+  const unsigned char *end = path + len;
+  const unsigned char *p;
+
+  for(p = path; p < end; p++) {
+    /* at the start of a segment */
+    if(*p == '.' && (p == path || p[-1] == '/')) {
+      size_t seg_len = 1;
+
+      if(p + 1 < end && p[1] == '.')
+        seg_len++;
+      if(p + seg_len == end || p[seg_len] == '/')
+        return 1;
+    }
+  }
+
+  return 0;
+}
+
+
 /**
  * raptor_uri_resolve_uri_reference:
  * @base_uri: Base URI string
@@ -261,9 +342,44 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
                                  const unsigned char *reference_uri,
                                  unsigned char *buffer, size_t length)
 {
-  raptor_uri_detail *ref = NULL;
-  raptor_uri_detail *base = NULL;
+  return raptor_uri_resolve_uri_reference_detail(base_uri, NULL,
+                                                 reference_uri,
+                                                 buffer, length);
+}
+
+
+/*
+ * raptor_uri_resolve_uri_reference_detail:
+ * @base_uri: Base URI string
+ * @base_detail: parsed @base_uri or NULL
+ * @reference_uri: Reference URI string
+ * @buffer: Destination buffer URI
+ * @length: Length of destination buffer
+ *
+ * INTERNAL - Resolve a URI to a base URI with an already parsed base
+ *
+ * If @base_detail is NULL the base URI is parsed when it is needed.
+ * @base_detail is not modified so it can be kept and shared between
+ * calls with the same base URI.  A reference that is a fragment,
+ * absolute or a relative path without "." or ".." segments is
+ * resolved without allocating.
+ *
+ * Return value: length of resolved string or 0 on failure
+ */
+size_t
+raptor_uri_resolve_uri_reference_detail(const unsigned char *base_uri,
+                                        raptor_uri_detail *base_detail,
+                                        const unsigned char *reference_uri,
+                                        unsigned char *buffer, size_t length)
+{
+  raptor_uri_detail ref_detail; /* static - pointers go to reference_uri */
+  raptor_uri_detail *ref = &ref_detail;
+  raptor_uri_detail *base = base_detail;
+  raptor_uri_detail *new_base = NULL;
   raptor_uri_detail result; /* static - pointers go to inside ref or base */
+  const unsigned char *base_path;
+  size_t base_path_len;
+  size_t dir_len;
   unsigned char *path_buffer = NULL;
   unsigned char *p, *cur, *prev, *s;
   unsigned char last_char;
@@ -279,10 +395,8 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
   *buffer = '\0';
   memset(&result, 0, sizeof(result));
 
-  ref = raptor_new_uri_detail(reference_uri);
-  if(!ref)
-    goto resolve_tidy;
-  
+  raptor_uri_detail_scan(reference_uri, ref);
+
 
   /* is reference URI "" or "#frag"? */
   if(!ref->scheme && !ref->authority && !ref->path && !ref->query) {
@@ -294,11 +408,10 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
     *p='\0';
     
     if(ref->fragment) {
-      unsigned char *src = ref->fragment;
       /* Append any fragment */
       *p++ = '#';
-      while(*src)
-        *p++ = *src++;
+      memcpy(p, ref->fragment, ref->fragment_len);
+      p += ref->fragment_len;
       *p='\0';
     }
 
@@ -316,9 +429,11 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
   
 
   /* now the reference URI must be schemeless, i.e. relative */
-  base = raptor_new_uri_detail(base_uri);
-  if(!base)
-    goto resolve_tidy;
+  if(!base) {
+    base = new_base = raptor_new_uri_detail(base_uri);
+    if(!base)
+      goto resolve_tidy;
+  }
 
   /* result URI must be of the base URI scheme */
   result.scheme = base->scheme;
@@ -353,19 +468,43 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
 
   /* need to resolve relative path */
 
-  /* Build the result path in path_buffer */
-  result.path_len = 0;
-
-  if(base->path)
-    result.path_len += base->path_len;
-  else {
+  if(base->path) {
+    base_path = base->path;
+    base_path_len = base->path_len;
+  } else {
     /* Add a missing path - makes the base URI 1 character longer */
-    base->path = (unsigned char*)"/"; /* static, but copied and not free()d  */
-    base->path_len = 1;
-    base->uri_len++;
-    result.path_len++;
+    base_path = (const unsigned char*)"/";
+    base_path_len = 1;
   }
 
+  /* the base path up to and including the last / */
+  for(p = (unsigned char*)base_path + base_path_len - 1;
+      p > base_path && *p != '/'; p--)
+    ;
+  dir_len = p - base_path + 1;
+
+  if(!raptor_uri_path_has_dot_segments(base_path, dir_len) &&
+     (!ref->path ||
+      !raptor_uri_path_has_dot_segments(ref->path, ref->path_len))) {
+    /* Nothing to remove from the merged path so write it straight to
+     * the result in the buffer after the scheme and authority */
+    p = buffer;
+    if(result.scheme)
+      p += result.scheme_len + 1;
+    if(result.authority)
+      p += 2 + result.authority_len;
+
+    memcpy(p, base_path, dir_len);
+    if(ref->path)
+      memcpy(p + dir_len, ref->path, ref->path_len);
+
+    result.path = p;
+    result.path_len = dir_len + ref->path_len;
+    goto resolve_end;
+  }
+
+  /* Build the result path in path_buffer */
+  result.path_len = dir_len;
   if(ref->path)
     result.path_len += ref->path_len;
 
@@ -376,22 +515,13 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
     goto resolve_tidy;
   }
   result.path = path_buffer;
-  *path_buffer = '\0';
-  
-  for(p = base->path + base->path_len-1; p > base->path && *p != '/'; p--)
-    ;
-
-  if(p >= base->path) {
-    result.path_len = p-base->path+1;
 
-    /* Found a /, copy everything before that to path_buffer */
-    memcpy(path_buffer, base->path, result.path_len);
-    path_buffer[result.path_len]='\0';
-  }
+  /* copy everything up to the last / to path_buffer */
+  memcpy(path_buffer, base_path, dir_len);
+  path_buffer[dir_len]='\0';
 
   if(ref->path) {
-    memcpy(path_buffer + result.path_len, ref->path, ref->path_len + 1);
-    result.path_len += ref->path_len;
+    memcpy(path_buffer + dir_len, ref->path, ref->path_len);
     path_buffer[result.path_len]='\0';
   }
 
@@ -405,7 +535,7 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
       unsigned char *dest = prev;
       
       p++;
-      while(*dest)
+      while(*p)
         *dest++ = *p++;
       *dest= '\0';
       
@@ -539,13 +669,13 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
   /* RFC3986 Appendix C.2 / 5.4.2 Abnormal Examples
    * Remove leading /../ and /./ 
    */
-  for(p = result.path; p; ) {
-    if(!strncmp((const char *)p, "/../", 4)) {
+  while(result.path) {
+    if(result.path_len >= 4 && !memcmp(result.path, "/../", 4)) {
+      result.path += 3;
       result.path_len -= 3;
-      memmove(p, p+3, result.path_len+1);
-    } else if(!strncmp((const char *)p, "/./", 3)) {
+    } else if(result.path_len >= 3 && !memcmp(result.path, "/./", 3)) {
+      result.path += 2;
       result.path_len -= 2;
-      memmove(p, p+2, result.path_len+1);
     } else
       break;
   }
@@ -576,7 +706,9 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
   }
   
   if(result.path) {
-    memcpy(p, result.path, result.path_len);
+    /* the path may already be in place in buffer */
+    if(p != result.path)
+      memmove(p, result.path, result.path_len);
     p+= result.path_len;
   }
   
@@ -598,10 +730,8 @@ raptor_uri_resolve_uri_reference(const unsigned char *base_uri,
   resolve_tidy:
   if(path_buffer)
     RAPTOR_FREE(char*, path_buffer);
-  if(base)
-    raptor_free_uri_detail(base);
-  if(ref)
-    raptor_free_uri_detail(ref);
+  if(new_base)
+    raptor_free_uri_detail(new_base);
 
 #ifdef RAPTOR_DEBUG
   RAPTOR_ASSERT(result_len && strlen((const char*)buffer) != result_len,
@@ -630,6 +760,7 @@ check_resolve(const char *base_uri, const char *reference_uri,
               const char *result_uri)
 {
   unsigned char buffer[1024];
+  raptor_uri_detail* base_detail;
 
   raptor_uri_resolve_uri_reference((const unsigned char*)base_uri,
                                    (const unsigned char*)reference_uri,
@@ -642,6 +773,28 @@ check_resolve(const char *base_uri, const char *reference_uri,
               buffer, result_uri);
       return 1;
   }
+
+  /* resolve again against an already parsed base, twice to check
+   * that the parsed base is not changed */
+  base_detail = raptor_new_uri_detail((const unsigned char*)base_uri);
+  raptor_uri_resolve_uri_reference_detail((const unsigned char*)base_uri,
+                                          base_detail,
+                                          (const unsigned char*)reference_uri,
+                                          buffer, sizeof(buffer));
+  if(!strcmp((const char*)buffer, result_uri))
+    raptor_uri_resolve_uri_reference_detail((const unsigned char*)base_uri,
+                                            base_detail,
+                                            (const unsigned char*)reference_uri,
+                                            buffer, sizeof(buffer));
+  raptor_free_uri_detail(base_detail);
+
+  if(strcmp((const char*)buffer, result_uri)) {
+      fprintf(stderr,
+              "%s: raptor_uri_resolve_uri_reference_detail(%s, %s) FAILED giving '%s' != '%s'\n",
+              program, base_uri, reference_uri, 
+              buffer, result_uri);
+      return 1;
+  }
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 2
   fprintf(stderr,
           "%s: raptor_uri_resolve_uri_reference(%s, %s) OK giving '%s'\n",
@@ -670,6 +823,77 @@ check_parses(const char *uri_string) {
 }
 
 
+static const char* const bench_references[] = {
+  "#frag",
+  "gpath",
+  "gpath/hpath#s",
+  "../gpath",
+  "http://example.org/other/path",
+  NULL
+};
+
+
+/*
+ * Time resolving references against the same base URI: with the base
+ * string parsed per call, with an already parsed base and with
+ * raptor_new_uri_relative_to_base() on a raptor_uri base which keeps
+ * its parsed form.
+ */
+static int
+bench_resolve(const char *base_uri_string, long iterations)
+{
+  raptor_world *world;
+  raptor_uri *base_uri;
+  raptor_uri_detail *base_detail;
+  unsigned char buffer[1024];
+  int i;
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world))
+    return 1;
+  base_uri = raptor_new_uri(world, (const unsigned char*)base_uri_string);
+  base_detail = raptor_new_uri_detail((const unsigned char*)base_uri_string);
+  if(!base_uri || !base_detail)
+    return 1;
+
+  for(i = 0; bench_references[i]; i++) {
+    const unsigned char *ref = (const unsigned char*)bench_references[i];
+    clock_t start;
+    double string_secs, detail_secs, uri_secs;
+    long n;
+
+    start = clock();
+    for(n = 0; n < iterations; n++)
+      raptor_uri_resolve_uri_reference((const unsigned char*)base_uri_string,
+                                       ref, buffer, sizeof(buffer));
+    string_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(n = 0; n < iterations; n++)
+      raptor_uri_resolve_uri_reference_detail((const unsigned char*)base_uri_string,
+                                              base_detail,
+                                              ref, buffer, sizeof(buffer));
+    detail_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for(n = 0; n < iterations; n++)
+      raptor_free_uri(raptor_new_uri_relative_to_base(world, base_uri, ref));
+    uri_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    fprintf(stderr,
+            "%s: %-30s %ld resolves: string base %.3fs, parsed base %.3fs, new URI %.3fs\n",
+            program, bench_references[i], iterations,
+            string_secs, detail_secs, uri_secs);
+  }
+
+  raptor_free_uri_detail(base_detail);
+  raptor_free_uri(base_uri);
+  raptor_free_world(world);
+
+  return 0;
+}
+
+
 int
 main(int argc, char *argv[]) 
 {
@@ -677,6 +901,10 @@ main(int argc, char *argv[])
   int failures = 0;
 
   program = raptor_basename(argv[0]);
+
+  /* raptor_rfc2396_test ITERATIONS runs a resolving benchmark */
+  if(argc > 1)
+    return bench_resolve(base_uri, atol(argv[1]));
   
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   fprintf(stderr, "%s: Using base URI '%s'\n", program, base_uri);
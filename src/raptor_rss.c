@@ -532,7 +532,6 @@ raptor_rss_start_element_handler(void *user_data,
      RAPTOR_RSS_INFO_FLAG_BLOCK_VALUE) {
     raptor_rss_type block_type;
     raptor_rss_item* update_item;
-    const unsigned char *id;
     raptor_term* block_term;
     
     block_type = raptor_rss_fields_info[rss_parser->current_field].block_type;
@@ -542,9 +541,7 @@ raptor_rss_start_element_handler(void *user_data,
 
     update_item = raptor_rss_get_current_item(rss_parser);
 
-    id = raptor_world_generate_bnodeid(rdf_parser->world);
-    block_term = raptor_new_term_from_blank(rdf_parser->world, id);
-    RAPTOR_FREE(char*, id);
+    block_term = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
     block = raptor_new_rss_block(rdf_parser->world, block_type, block_term);
     raptor_free_term(block_term);
@@ -1047,12 +1044,8 @@ raptor_rss_insert_identifiers(raptor_parser* rdf_parser)
         }
       
         if(!item->term) {
-          const unsigned char *id;
-
           /* need to make bnode */
-          id = raptor_world_generate_bnodeid(rdf_parser->world);
-          item->term = raptor_new_term_from_blank(rdf_parser->world, id);
-          RAPTOR_FREE(char*, id);
+          item->term = raptor_new_term_from_blank(rdf_parser->world, NULL);
         }
       }
 
@@ -1101,11 +1094,8 @@ raptor_rss_insert_identifiers(raptor_parser* rdf_parser)
     
     for(block = item->blocks; block; block = block->next) {
       if(!block->identifier) {
-        const unsigned char *id;
         /* need to make bnode */
-        id = raptor_world_generate_bnodeid(rdf_parser->world);
-        item->term = raptor_new_term_from_blank(rdf_parser->world, id);
-        RAPTOR_FREE(char*, id);
+        item->term = raptor_new_term_from_blank(rdf_parser->world, NULL);
       }
     }
     
@@ -1141,7 +1131,7 @@ raptor_rss_emit_type_triple(raptor_parser* rdf_parser,
   rss_parser->statement.object = object_term;
   
   /* Generate the statement */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data, &rss_parser->statement);
+  raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
 
   raptor_free_term(predicate_term);
   raptor_free_term(object_term);
@@ -1175,8 +1165,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
   rss_parser->statement.subject = resource;
   rss_parser->statement.predicate = predicate_term;
   rss_parser->statement.object = block->identifier;
-  (*rdf_parser->statement_handler)(rdf_parser->user_data,
-                                   &rss_parser->statement);
+  raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
 
   raptor_free_term(predicate_term); predicate_term = NULL;
 
@@ -1209,8 +1198,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
         
         object_term = raptor_new_term_from_uri(rdf_parser->world, uri);
         rss_parser->statement.object = object_term;
-        (*rdf_parser->statement_handler)(rdf_parser->user_data,
-                                         &rss_parser->statement);
+        raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
         raptor_free_term(object_term);
       }
     } else if(attribute_type == RSS_BLOCK_FIELD_TYPE_STRING) {
@@ -1222,8 +1210,7 @@ raptor_rss_emit_block(raptor_parser* rdf_parser,
                                                    (const unsigned char*)str,
                                                    NULL, NULL);
         rss_parser->statement.object = object_term;
-        (*rdf_parser->statement_handler)(rdf_parser->user_data,
-                                         &rss_parser->statement);
+        raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
         raptor_free_term(object_term);
       }
     } else {
@@ -1295,8 +1282,7 @@ raptor_rss_emit_item(raptor_parser* rdf_parser, raptor_rss_item *item)
       rss_parser->statement.object = object_term;
       
       /* Generate the statement */
-      (*rdf_parser->statement_handler)(rdf_parser->user_data,
-                                       &rss_parser->statement);
+      raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
 
       raptor_free_term(object_term);
     }
@@ -1340,8 +1326,7 @@ raptor_rss_emit_connection(raptor_parser* rdf_parser,
   rss_parser->statement.object = object_identifier;
   
   /* Generate the statement */
-  (*rdf_parser->statement_handler)(rdf_parser->user_data,
-                                   &rss_parser->statement);
+  raptor_parser_emit_statement(rdf_parser, &rss_parser->statement);
 
   raptor_free_term(predicate_term);
   
@@ -1411,14 +1396,10 @@ raptor_rss_emit(raptor_parser* rdf_parser)
 
   /* Emit the feed item blocks */
   if(rss_parser->model.items_count) {
-    const unsigned char* id;
     raptor_term *items;
 
-    id = raptor_world_generate_bnodeid(rdf_parser->world);
-    
     /* make a new genid for the <rdf:Seq> node */
-    items = raptor_new_term_from_blank(rdf_parser->world, id);
-    RAPTOR_FREE(char*, id);
+    items = raptor_new_term_from_blank(rdf_parser->world, NULL);
 
     /* _:genid1 rdf:type rdf:Seq . */
     if(raptor_rss_emit_type_triple(rdf_parser, items,
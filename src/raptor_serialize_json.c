@@ -62,6 +62,17 @@ typedef struct {
 
   int need_object_comma;
 
+  /* non-0 if the triples of each subject arrive together */
+  int sorted_input;
+
+  /* with sorted input, subject of the triples in the tree */
+  raptor_term* sorted_subject;
+
+  /* with sorted input, subjects already written; a JSON object
+   * cannot have the same subject key twice.  This grows with the
+   * number of subjects, not triples */
+  raptor_avltree* written_subjects;
+
 } raptor_json_context;
 
 
@@ -72,6 +83,7 @@ static int raptor_json_serialize_start(raptor_serializer* serializer);
 static int raptor_json_serialize_statement(raptor_serializer* serializer, 
                                            raptor_statement *statement);
 static int raptor_json_serialize_end(raptor_serializer* serializer);
+static int raptor_json_serialize_avltree_visit(int depth, void* data, void *user_data);
 static void raptor_json_serialize_finish_factory(raptor_serializer_factory* factory);
 
 
@@ -110,6 +122,16 @@ raptor_json_serialize_terminate(raptor_serializer* serializer)
     raptor_free_avltree(context->avltree);
     context->avltree = NULL;
   }
+
+  if(context->sorted_subject) {
+    raptor_free_term(context->sorted_subject);
+    context->sorted_subject = NULL;
+  }
+
+  if(context->written_subjects) {
+    raptor_free_avltree(context->written_subjects);
+    context->written_subjects = NULL;
+  }
 }
 
 
@@ -147,7 +169,22 @@ raptor_json_serialize_start(raptor_serializer* serializer)
     raptor_iostream_write_byte('(', serializer->iostream);
   }
 
-  if(!context->is_resource) {
+  if(context->is_resource) {
+    context->sorted_input = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                       RAPTOR_OPTION_SERIALIZE_SORTED_INPUT);
+    if(context->sorted_input) {
+      context->written_subjects = raptor_new_avltree((raptor_data_compare_handler)raptor_term_compare,
+                                                     (raptor_data_free_handler)raptor_free_term,
+                                                     0);
+      if(!context->written_subjects)
+        return 1;
+
+      /* start outer object now as resources are written as they end */
+      raptor_json_writer_newline(context->json_writer);
+      raptor_json_writer_start_block(context->json_writer, '{');
+      raptor_json_writer_newline(context->json_writer);
+    }
+  } else {
     /* start outer object */
     raptor_json_writer_start_block(context->json_writer, '{');
     raptor_json_writer_newline(context->json_writer);
@@ -163,6 +200,96 @@ raptor_json_serialize_start(raptor_serializer* serializer)
 }
 
 
+/*
+ * raptor_json_serialize_write_resources:
+ * @serializer: #raptor_serializer object
+ *
+ * INTERNAL - Write the triples in the tree as resources and empty it
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_json_serialize_write_resources(raptor_serializer* serializer)
+{
+  raptor_json_context* context = (raptor_json_context*)serializer->context;
+
+  raptor_avltree_visit(context->avltree,
+                       raptor_json_serialize_avltree_visit,
+                       serializer);
+
+  /* end last triples block */
+  if(context->last_statement) {
+    raptor_json_writer_newline(context->json_writer);
+    raptor_json_writer_end_block(context->json_writer, ']');
+    raptor_json_writer_newline(context->json_writer);
+
+    raptor_json_writer_end_block(context->json_writer, '}');
+    raptor_json_writer_newline(context->json_writer);
+
+    context->last_statement = NULL;
+    context->need_subject_comma = 1;
+  }
+
+  raptor_free_avltree(context->avltree);
+  context->avltree = raptor_new_avltree((raptor_data_compare_handler)raptor_statement_compare,
+                                        (raptor_data_free_handler)raptor_free_statement,
+                                        0);
+  return !context->avltree;
+}
+
+
+/*
+ * raptor_json_serialize_sorted_subject:
+ * @serializer: #raptor_serializer object
+ * @term: subject of the next triple
+ *
+ * INTERNAL - With sorted input, write and free the triples of the
+ * previous subject if @term starts a new subject group
+ *
+ * A subject seen again after its group ended cannot be merged into the
+ * object already written, so it is reported as an error.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_json_serialize_sorted_subject(raptor_serializer* serializer,
+                                     raptor_term* term)
+{
+  raptor_json_context* context = (raptor_json_context*)serializer->context;
+  int rc;
+
+  if(context->sorted_subject) {
+    if(raptor_term_equals(context->sorted_subject, term))
+      return 0;
+
+    if(raptor_json_serialize_write_resources(serializer))
+      return 1;
+
+    /* tree takes ownership */
+    rc = raptor_avltree_add(context->written_subjects,
+                            context->sorted_subject);
+    context->sorted_subject = NULL;
+    if(rc < 0)
+      return 1;
+  }
+
+  if(raptor_avltree_search(context->written_subjects, term)) {
+    unsigned char* str = raptor_term_to_string(term);
+    raptor_log_error_formatted(serializer->world, RAPTOR_LOG_LEVEL_ERROR,
+                               NULL,
+                               "Subject %s appears again after other subjects; input is not grouped by subject",
+                               str ? (const char*)str : "");
+    if(str)
+      raptor_free_memory(str);
+    return 1;
+  }
+
+  context->sorted_subject = raptor_term_copy(term);
+
+  return !context->sorted_subject;
+}
+
+
 static int
 raptor_json_serialize_statement(raptor_serializer* serializer, 
                                 raptor_statement *statement)
@@ -170,7 +297,13 @@ raptor_json_serialize_statement(raptor_serializer* serializer,
   raptor_json_context* context = (raptor_json_context*)serializer->context;
 
   if(context->is_resource) {
-    raptor_statement* s = raptor_statement_copy(statement);
+    raptor_statement* s;
+
+    if(context->sorted_input &&
+       raptor_json_serialize_sorted_subject(serializer, statement->subject))
+      return 1;
+
+    s = raptor_statement_copy(statement);
     if(!s)
       return 1;
     return raptor_avltree_add(context->avltree, s);
@@ -414,27 +547,28 @@ raptor_json_serialize_end(raptor_serializer* serializer)
   raptor_json_context* context = (raptor_json_context*)serializer->context;
   char* value;
   
-  raptor_json_writer_newline(context->json_writer);
-
   if(context->is_resource) {
-    /* start outer object */
-    raptor_json_writer_start_block(context->json_writer, '{');
-    raptor_json_writer_newline(context->json_writer);
-    
-    raptor_avltree_visit(context->avltree,
-                         raptor_json_serialize_avltree_visit,
-                         serializer);
-
-    /* end last triples block */
-    if(context->last_statement) {
+    if(!context->sorted_input) {
+      /* start outer object */
       raptor_json_writer_newline(context->json_writer);
-      raptor_json_writer_end_block(context->json_writer, ']');
-      raptor_json_writer_newline(context->json_writer);
-      
-      raptor_json_writer_end_block(context->json_writer, '}');
+      raptor_json_writer_start_block(context->json_writer, '{');
       raptor_json_writer_newline(context->json_writer);
     }
+    
+    raptor_json_serialize_write_resources(serializer);
+
+    if(context->sorted_subject) {
+      raptor_free_term(context->sorted_subject);
+      context->sorted_subject = NULL;
+    }
+
+    if(context->written_subjects) {
+      raptor_free_avltree(context->written_subjects);
+      context->written_subjects = NULL;
+    }
   } else {
+    raptor_json_writer_newline(context->json_writer);
+
     /* end triples array */
     raptor_json_writer_end_block(context->json_writer, ']');
     raptor_json_writer_newline(context->json_writer);
@@ -137,7 +137,7 @@ raptor_bnodeid_ntriples_write(const unsigned char *bnodeid,
 {
   unsigned int i;
 
-  raptor_iostream_counted_string_write("_:", 2, iostr);
+  raptor_iostream_put_counted_string("_:", 2, iostr);
 
   for(i = 0; i < len; i++) {
     unsigned char c = *bnodeid++;
@@ -145,7 +145,7 @@ raptor_bnodeid_ntriples_write(const unsigned char *bnodeid,
       /* Replace characters not in legal N-Triples bnode set */
       c = 'z';
     }
-    raptor_iostream_write_byte(c, iostr);
+    raptor_iostream_put_byte(c, iostr);
   }
 
   return 0;
@@ -172,21 +172,21 @@ raptor_term_ntriples_write(const raptor_term *term, raptor_iostream* iostr)
   
   switch(term->type) {
     case RAPTOR_TERM_TYPE_LITERAL:
-      raptor_iostream_write_byte('"', iostr);
+      raptor_iostream_put_byte('"', iostr);
       raptor_string_ntriples_write(term->value.literal.string,
                                    term->value.literal.string_len,
                                    '"',
                                    iostr);
-      raptor_iostream_write_byte('"', iostr);
+      raptor_iostream_put_byte('"', iostr);
       if(term->value.literal.language) {
-        raptor_iostream_write_byte('@', iostr);
+        raptor_iostream_put_byte('@', iostr);
         raptor_iostream_string_write(term->value.literal.language, iostr);
       }
       if(term->value.literal.datatype) {
-        raptor_iostream_counted_string_write("^^<", 3, iostr);
+        raptor_iostream_put_counted_string("^^<", 3, iostr);
         raptor_iostream_string_write(raptor_uri_as_string(term->value.literal.datatype),
                                      iostr);
-        raptor_iostream_write_byte('>', iostr);
+        raptor_iostream_put_byte('>', iostr);
       }
 
       break;
@@ -198,10 +198,10 @@ raptor_term_ntriples_write(const raptor_term *term, raptor_iostream* iostr)
       break;
       
     case RAPTOR_TERM_TYPE_URI:
-      raptor_iostream_write_byte('<', iostr);
+      raptor_iostream_put_byte('<', iostr);
       term_str = raptor_uri_as_counted_string(term->value.uri, &len);
       raptor_string_ntriples_write(term_str, len, '>', iostr);
-      raptor_iostream_write_byte('>', iostr);
+      raptor_iostream_put_byte('>', iostr);
       break;
       
     case RAPTOR_TERM_TYPE_UNKNOWN:
@@ -237,21 +237,21 @@ raptor_statement_ntriples_write(const raptor_statement *statement,
   if(raptor_term_ntriples_write(statement->subject, iostr))
     return 1;
   
-  raptor_iostream_write_byte(' ', iostr);
+  raptor_iostream_put_byte(' ', iostr);
   if(raptor_term_ntriples_write(statement->predicate, iostr))
     return 1;
   
-  raptor_iostream_write_byte(' ', iostr);
+  raptor_iostream_put_byte(' ', iostr);
   if(raptor_term_ntriples_write(statement->object, iostr))
     return 1;
 
   if(statement->graph && write_graph_term) {
-    raptor_iostream_write_byte(' ', iostr);
+    raptor_iostream_put_byte(' ', iostr);
     if(raptor_term_ntriples_write(statement->graph, iostr))
       return 1;
   }
   
-  raptor_iostream_counted_string_write(" .\n", 3, iostr);
+  raptor_iostream_put_counted_string(" .\n", 3, iostr);
 
   return 0;
 }
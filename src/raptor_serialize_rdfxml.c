@@ -246,6 +246,9 @@ raptor_rdfxml_serialize_start(raptor_serializer* serializer)
   raptor_xml_writer_set_option(xml_writer, option, NULL,
                                RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
   option = RAPTOR_OPTION_WRITER_XML_DECLARATION;
+  raptor_xml_writer_set_option(xml_writer, option, NULL,
+                               RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
+  option = RAPTOR_OPTION_WRITER_XML_TRUST_UTF8;
   raptor_xml_writer_set_option(xml_writer, option, NULL,
                                RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
 
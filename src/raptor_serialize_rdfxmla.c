@@ -91,6 +91,12 @@ typedef struct {
 
   /* If non-0, emit typed nodes */
   int write_typed_nodes;
+
+  /* non-0 if the triples of each subject arrive together */
+  int sorted_input;
+
+  /* with sorted input, subject of the triples in the trees */
+  raptor_term* sorted_subject;
 } raptor_rdfxmla_context;
 
 
@@ -972,6 +978,11 @@ raptor_rdfxmla_serialize_terminate(raptor_serializer* serializer)
     raptor_free_avltree(context->nodes);
     context->nodes = NULL;
   }
+
+  if(context->sorted_subject) {
+    raptor_free_term(context->sorted_subject);
+    context->sorted_subject = NULL;
+  }
   
   /* always free raptor_namespace* before stack */
   if(context->nstack) {
@@ -1183,6 +1194,9 @@ raptor_rdfxmla_serialize_start(raptor_serializer* serializer)
 {
   raptor_rdfxmla_context* context = (raptor_rdfxmla_context*)serializer->context;
 
+  context->sorted_input = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                     RAPTOR_OPTION_SERIALIZE_SORTED_INPUT);
+
   if(!context->external_xml_writer) {
     raptor_xml_writer* xml_writer;
     raptor_option option;
@@ -1205,6 +1219,9 @@ raptor_rdfxmla_serialize_start(raptor_serializer* serializer)
     raptor_xml_writer_set_option(xml_writer, option, NULL,
                                  RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
     option = RAPTOR_OPTION_WRITER_XML_DECLARATION;
+    raptor_xml_writer_set_option(xml_writer, option, NULL,
+                                 RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
+    option = RAPTOR_OPTION_WRITER_XML_TRUST_UTF8;
     raptor_xml_writer_set_option(xml_writer, option, NULL,
                                  RAPTOR_OPTIONS_GET_NUMERIC(serializer, option));
 
@@ -1306,6 +1323,50 @@ raptor_rdfxmla_ensure_writen_header(raptor_serializer* serializer,
 }
   
 
+/*
+ * raptor_rdfxmla_sorted_subject:
+ * @serializer: #raptor_serializer object
+ * @term: subject of the next triple
+ *
+ * INTERNAL - With sorted input, emit and free the triples of the
+ * previous subject if @term starts a new subject group
+ *
+ * A subject group that is a blank node or has blank node objects is
+ * kept back until the end, when the use counts of the blank nodes
+ * are known and those used once can be nested as usual.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_rdfxmla_sorted_subject(raptor_serializer* serializer, raptor_term* term)
+{
+  raptor_rdfxmla_context* context = (raptor_rdfxmla_context*)serializer->context;
+  raptor_abbrev_subject* subject;
+
+  if(context->sorted_subject) {
+    if(raptor_term_equals(context->sorted_subject, term))
+      return 0;
+
+    subject = raptor_abbrev_subject_find(context->subjects,
+                                         context->sorted_subject);
+    if(subject && !raptor_abbrev_subject_uses_blank(subject)) {
+      if(raptor_rdfxmla_ensure_writen_header(serializer, context) ||
+         raptor_rdfxmla_emit_subject(serializer, subject,
+                                     context->starting_depth) ||
+         raptor_abbrev_subject_delete(context->nodes, context->subjects,
+                                      subject))
+        return 1;
+    }
+
+    raptor_free_term(context->sorted_subject);
+  }
+
+  context->sorted_subject = raptor_term_copy(term);
+
+  return !context->sorted_subject;
+}
+
+
 /* serialize a statement */
 static int
 raptor_rdfxmla_serialize_statement(raptor_serializer* serializer, 
@@ -1326,6 +1387,10 @@ raptor_rdfxmla_serialize_statement(raptor_serializer* serializer,
     return 1;
   }  
 
+  if(context->sorted_input &&
+     raptor_rdfxmla_sorted_subject(serializer, statement->subject))
+    return 1;
+
   subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
                                          context->blanks,
                                          statement->subject);
@@ -1470,6 +1535,11 @@ raptor_rdfxmla_serialize_end(raptor_serializer* serializer)
     raptor_free_uri(context->single_node);
 
   context->written_header = 0;
+
+  if(context->sorted_subject) {
+    raptor_free_term(context->sorted_subject);
+    context->sorted_subject = NULL;
+  }
   
   return 0;
 }
@@ -2187,6 +2187,9 @@ raptor_rss10_serialize_end(raptor_serializer* serializer)
                                RAPTOR_OPTION_WRITER_AUTO_INDENT, NULL, 1);
   raptor_xml_writer_set_option(xml_writer,
                                RAPTOR_OPTION_WRITER_AUTO_EMPTY, NULL, 1);
+  raptor_xml_writer_set_option(xml_writer,
+                               RAPTOR_OPTION_WRITER_XML_TRUST_UTF8, NULL,
+                               RAPTOR_OPTIONS_GET_NUMERIC(serializer, RAPTOR_OPTION_WRITER_XML_TRUST_UTF8));
 
   raptor_rss10_build_xml_names(serializer, (is_atom && entry_uri));
 
@@ -42,6 +42,7 @@
 #ifdef HAVE_STDLIB_H
 #include <stdlib.h>
 #endif
+#include <sys/types.h>
 
 /* Raptor includes */
 #include "raptor2.h"
@@ -51,6 +52,145 @@
 #define MAX_ASCII_INT_SIZE 13
 
 
+/* Size of the read buffer of each spilled run and of the one used
+ * to search for blank nodes
+ */
+#define TURTLE_RUN_BUFFER_SIZE 16384
+#define TURTLE_RUN_SEARCH_BUFFER_SIZE 4096
+
+/* Size of range that a search for a blank node reads through */
+#define TURTLE_RUN_SEARCH_SCAN_SIZE 256
+
+/* Number of binary search steps for blank nodes to remember; all
+ * searches start with the same steps so the first ones are cached
+ */
+#define TURTLE_SEARCH_STEPS_SIZE 1023
+
+/* Number of runs of one size that are merged into one longer run */
+#define TURTLE_RUN_MERGE_WIDTH 16
+
+/* Offset in a run file; runs may be larger than a long can hold */
+#ifdef WIN32
+typedef __int64 raptor_turtle_offset;
+#define TURTLE_RUN_SEEK(handle, offset) _fseeki64(handle, offset, SEEK_SET)
+#define TURTLE_RUN_TELL(handle) _ftelli64(handle)
+#elif defined(HAVE_FSEEKO) && defined(HAVE_FTELLO)
+typedef off_t raptor_turtle_offset;
+#define TURTLE_RUN_SEEK(handle, offset) fseeko(handle, offset, SEEK_SET)
+#define TURTLE_RUN_TELL(handle) ftello(handle)
+#else
+typedef long raptor_turtle_offset;
+#define TURTLE_RUN_SEEK(handle, offset) fseek(handle, offset, SEEK_SET)
+#define TURTLE_RUN_TELL(handle) ftell(handle)
+#endif
+
+/* Approximate heap use of a node, a subject and a property pair
+ * including their AVL tree entries; term strings are added to nodes
+ */
+#define TURTLE_NODE_COST (sizeof(raptor_abbrev_node) + sizeof(raptor_term) + 64)
+#define TURTLE_SUBJECT_COST (sizeof(raptor_abbrev_subject) + 192)
+#define TURTLE_PROPERTY_COST (2 * sizeof(raptor_abbrev_node*) + 64)
+
+
+/*
+ * Sorted run of records spilled to a temporary file
+ *
+ * A record is a line of tab-terminated fields: the subject term then
+ * either the predicate and object terms or '#' and the count of
+ * references to the (blank node) subject as an object.  A term field
+ * starts with 'U', 'B' or 'L'; literals have two more fields for the
+ * language and datatype URI.  Backslash, tab, newline and NUL are
+ * escaped with a backslash.
+ *
+ * Records are in (subject, predicate, object) order as used by the
+ * subjects and blanks trees, where the count record of a subject
+ * comes first, so URI subjects come before blank node subjects.
+ */
+typedef struct {
+  FILE* handle;
+
+  /* offset of the first blank node subject record */
+  raptor_turtle_offset blank;
+
+  /* length of the run */
+  raptor_turtle_offset end;
+
+  /* number of merges that made this run */
+  int level;
+} raptor_turtle_run;
+
+
+/* Record read from a run: a triple or, if predicate is NULL, the
+ * count of references to the subject as an object
+ */
+typedef struct {
+  raptor_term* subject;
+  raptor_term* predicate;
+  raptor_term* object;
+  int count;
+} raptor_turtle_record;
+
+
+/* Reader of records from a byte range of a run */
+typedef struct {
+  raptor_world* world;
+  FILE* handle;
+
+  /* file offset after the bytes in buffer and end of the range */
+  raptor_turtle_offset offset;
+  raptor_turtle_offset end;
+
+  unsigned char* buffer;
+  size_t buffer_size;
+  size_t length;
+  size_t pos;
+
+  /* decoded fields of the current record, each NUL terminated */
+  unsigned char* field;
+  size_t field_length;
+  size_t field_size;
+
+  /* current record; has_record is 0 after the end of the range */
+  raptor_turtle_record record;
+  int has_record;
+
+  /* non 0 after a read failure or a malformed record */
+  int failed;
+} raptor_turtle_run_reader;
+
+
+/* Binary search step: the record found in the middle of a range */
+typedef struct {
+  /* record subject or NULL if the step has not been made */
+  raptor_term* subject;
+
+  /* offsets of the record and after it */
+  raptor_turtle_offset start;
+  raptor_turtle_offset end;
+} raptor_turtle_search_step;
+
+
+/* Part of a run to read: all of it, the URI subjects or the blank
+ * node subjects
+ */
+typedef enum {
+  TURTLE_RUN_ALL,
+  TURTLE_RUN_URIS,
+  TURTLE_RUN_BLANKS
+} raptor_turtle_run_part;
+
+
+/* Merge of several runs in record order */
+typedef struct {
+  raptor_turtle_run_reader* readers;
+  int readers_count;
+
+  /* readers that have a record, as a heap ordered by record */
+  raptor_turtle_run_reader** heap;
+  int heap_count;
+} raptor_turtle_merge;
+
+
 /*
  * Raptor turtle serializer object
  */
@@ -83,6 +223,28 @@ typedef struct {
 
   /* for labeling namespaces */
   int namespace_count;
+
+  /* approximate memory limit in bytes before spilling runs or 0 */
+  size_t memory_limit;
+
+  /* approximate memory used by the subjects, blanks and nodes trees */
+  size_t memory_used;
+
+  /* sorted runs of triples spilled to temporary files */
+  raptor_turtle_run* runs;
+  int runs_count;
+  int runs_size;
+
+  /* merged blank node subjects, searched while emitting from runs */
+  raptor_turtle_run blank_run;
+  raptor_turtle_run_reader* blank_reader;
+  raptor_turtle_search_step* search_steps;
+
+  /* non-0 if the triples of each subject arrive together */
+  int sorted_input;
+
+  /* with sorted input, subject of the triples in the trees */
+  raptor_term* sorted_subject;
 } raptor_turtle_context;
 
 
@@ -111,6 +273,11 @@ static int raptor_turtle_emit_subject(raptor_serializer *serializer,
                                       raptor_abbrev_subject* subject,
                                       int depth);
 static int raptor_turtle_emit(raptor_serializer *serializer);
+static raptor_abbrev_subject* raptor_turtle_find_blank(raptor_serializer* serializer,
+                                                       raptor_abbrev_node* node);
+static int raptor_turtle_spill_load_blank(raptor_serializer* serializer,
+                                          raptor_abbrev_node* node,
+                                          int always);
 
 static int raptor_turtle_serialize_init(raptor_serializer* serializer,
                                         const char *name);
@@ -266,6 +433,17 @@ raptor_turtle_emit_blank(raptor_serializer *serializer,
   
   if(node->term->type != RAPTOR_TERM_TYPE_BLANK)
     return 1;
+
+  /* When emitting from spilled runs, the counts of a blank node
+   * that is not the subject being emitted are read from the runs
+   * along with the subject itself if it can be inlined.
+   */
+  if(context->blank_reader &&
+     !node->count_as_subject && !node->count_as_object) {
+    rc = raptor_turtle_spill_load_blank(serializer, node, 0);
+    if(rc)
+      return rc;
+  }
   
   if((node->count_as_subject == 1 && node->count_as_object == 1)) {
     /* If this is only used as a 1 subject and object or never
@@ -273,7 +451,7 @@ raptor_turtle_emit_blank(raptor_serializer *serializer,
      * be referenced with an explicit name */
     raptor_abbrev_subject* blank;
 
-    blank = raptor_abbrev_subject_find(context->blanks, node->term);
+    blank = raptor_turtle_find_blank(serializer, node);
     if(blank) {
       rc = raptor_turtle_emit_subject(serializer, blank, depth+1);
       raptor_abbrev_subject_invalidate(blank);
@@ -449,7 +627,7 @@ raptor_turtle_emit_subject_collection_items(raptor_serializer* serializer,
     }
     
     if(object->term->type == RAPTOR_TERM_TYPE_BLANK) {
-      subject = raptor_abbrev_subject_find(context->blanks, object->term);
+      subject = raptor_turtle_find_blank(serializer, object);
 
       if(!subject) {
         raptor_log_error(serializer->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
@@ -784,27 +962,32 @@ raptor_turtle_emit(raptor_serializer *serializer)
 
 
 /*
- * raptor serializer Turtle implementation
+ * Spilling triples to sorted runs in temporary files
+ *
+ * When the approximate memory used by the trees goes over the
+ * serializeMemoryLimit option, the triples are written out as a
+ * sorted run and the trees emptied.  Runs of the same length are
+ * merged into one when there are TURTLE_RUN_MERGE_WIDTH of them.
+ *
+ * At the end, the blank node subjects of all runs are merged into
+ * one run that is binary searched for the blank nodes to inline.
+ * The URI subjects and then the blank node subjects are merged and
+ * each subject is emitted from the trees as it is completed, so the
+ * output is the same as without spilling.
  */
 
 
-/* create a new serializer */
+/*
+ * raptor_turtle_new_trees:
+ * @context: Turtle serializer context
+ *
+ * INTERNAL - Create empty subjects, blanks and nodes trees
+ *
+ * Return value: non-0 on failure
+ */
 static int
-raptor_turtle_serialize_init(raptor_serializer* serializer, const char *name)
+raptor_turtle_new_trees(raptor_turtle_context* context)
 {
-  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
-  raptor_uri *rdf_type_uri;
-
-  context->nstack = raptor_new_namespaces(serializer->world, 1);
-  if(!context->nstack)
-    return 1;
-  context->rdf_nspace = raptor_new_namespace(context->nstack,
-                                             (const unsigned char*)"rdf",
-                                             (const unsigned char*)raptor_rdf_namespace_uri,
-                                              0);
-
-  context->namespaces = raptor_new_sequence(NULL, NULL);
-
   context->subjects =
     raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_subject_compare,
                        (raptor_data_free_handler)raptor_free_abbrev_subject, 0);
@@ -817,72 +1000,15 @@ raptor_turtle_serialize_init(raptor_serializer* serializer, const char *name)
     raptor_new_avltree((raptor_data_compare_handler)raptor_abbrev_node_compare,
                        (raptor_data_free_handler)raptor_free_abbrev_node, 0);
 
-  rdf_type_uri = raptor_new_uri_for_rdf_concept(serializer->world,
-                                                (const unsigned char*)"type");
-  if(rdf_type_uri) {
-    raptor_term* uri_term;
-    uri_term = raptor_new_term_from_uri(serializer->world,
-                                        rdf_type_uri);
-    raptor_free_uri(rdf_type_uri);
-    context->rdf_type = raptor_new_abbrev_node(serializer->world, uri_term);
-    raptor_free_term(uri_term);
-  } else
-    context->rdf_type = NULL;
-
-  context->rdf_xml_literal_uri = raptor_new_uri(serializer->world, raptor_xml_literal_datatype_uri_string);
-  context->rdf_first_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#first");
-  context->rdf_rest_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#rest");
-  context->rdf_nil_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#nil");
-
-  if(!context->rdf_nspace || !context->namespaces ||
-     !context->subjects || !context->blanks || !context->nodes ||
-     !context->rdf_xml_literal_uri || !context->rdf_first_uri ||
-     !context->rdf_rest_uri || !context->rdf_nil_uri || !context->rdf_type)
-  {
-    raptor_turtle_serialize_terminate(serializer);
-    return 1;
-  }
+  context->memory_used = 0;
 
-  /* Note: item 0 in the list is rdf:RDF's namespace */
-  if(raptor_sequence_push(context->namespaces, context->rdf_nspace)) {
-    raptor_turtle_serialize_terminate(serializer);
-    return 1;
-  }
-
-  return 0;
+  return (!context->subjects || !context->blanks || !context->nodes);
 }
 
 
-/* destroy a serializer */
 static void
-raptor_turtle_serialize_terminate(raptor_serializer* serializer)
+raptor_turtle_free_trees(raptor_turtle_context* context)
 {
-  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
-
-  if(context->turtle_writer) {
-    raptor_free_turtle_writer(context->turtle_writer);
-    context->turtle_writer = NULL;
-  }
-
-  if(context->rdf_nspace) {
-    raptor_free_namespace(context->rdf_nspace);
-    context->rdf_nspace = NULL;
-  }
-
-  if(context->namespaces) {
-    int i;
-
-    /* Note: item 0 in the list is rdf:RDF's namespace and freed above */
-    for(i = 1; i< raptor_sequence_size(context->namespaces); i++) {
-      raptor_namespace* ns;
-      ns =(raptor_namespace*)raptor_sequence_get_at(context->namespaces, i);
-      if(ns)
-        raptor_free_namespace(ns);
-    }
-    raptor_free_sequence(context->namespaces);
-    context->namespaces = NULL;
-  }
-
   if(context->subjects) {
     raptor_free_avltree(context->subjects);
     context->subjects = NULL;
@@ -897,138 +1023,1478 @@ raptor_turtle_serialize_terminate(raptor_serializer* serializer)
     raptor_free_avltree(context->nodes);
     context->nodes = NULL;
   }
+}
 
-  if(context->nstack) {
-    raptor_free_namespaces(context->nstack);
-    context->nstack = NULL;
-  }
 
-  if(context->rdf_type) {
-    raptor_free_abbrev_node(context->rdf_type);
-    context->rdf_type = NULL;
-  }
+/* approximate memory used by a node for @term */
+static size_t
+raptor_turtle_term_cost(raptor_term* term)
+{
+  size_t cost = TURTLE_NODE_COST;
+  size_t len;
 
-  if(context->rdf_xml_literal_uri) {
-    raptor_free_uri(context->rdf_xml_literal_uri);
-    context->rdf_xml_literal_uri = NULL;
-  }
+  switch(term->type) {
+    case RAPTOR_TERM_TYPE_URI:
+      (void)raptor_uri_as_counted_string(term->value.uri, &len);
+      cost += len + 1;
+      break;
 
-  if(context->rdf_first_uri) {
-    raptor_free_uri(context->rdf_first_uri);
-    context->rdf_first_uri = NULL;
-  }
+    case RAPTOR_TERM_TYPE_LITERAL:
+      cost += term->value.literal.string_len + 1;
+      cost += term->value.literal.language_len;
+      break;
 
-  if(context->rdf_rest_uri) {
-    raptor_free_uri(context->rdf_rest_uri);
-    context->rdf_rest_uri = NULL;
-  }
+    case RAPTOR_TERM_TYPE_BLANK:
+      cost += term->value.blank.string_len + 1;
+      break;
 
-  if(context->rdf_nil_uri) {
-    raptor_free_uri(context->rdf_nil_uri);
-    context->rdf_nil_uri = NULL;
+    case RAPTOR_TERM_TYPE_UNKNOWN:
+    default:
+      break;
   }
-}
 
+  return cost;
+}
 
-#define TURTLE_NAMESPACE_DEPTH 0
 
-/* add a namespace */
-static int
-raptor_turtle_serialize_declare_namespace_from_namespace(raptor_serializer* serializer, 
-                                                         raptor_namespace *nspace)
+/* count the memory used by a node for @term if a lookup added one */
+static void
+raptor_turtle_count_node(raptor_turtle_context* context, int* nodes_count_p,
+                         raptor_term* term)
 {
-  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
-  int i;
- 
-  if(context->written_header)
-    return 1;
-  
-  for(i = 0; i< raptor_sequence_size(context->namespaces); i++) {
-    raptor_namespace* ns;
-    ns = (raptor_namespace*)raptor_sequence_get_at(context->namespaces, i);
-
-    /* If prefix is already declared, ignore it */
-    if(!ns->prefix && !nspace->prefix)
-      return 1;
-    
-    if(ns->prefix && nspace->prefix && 
-       !strcmp((const char*)ns->prefix, (const char*)nspace->prefix))
-      return 1;
+  int nodes_count = raptor_avltree_size(context->nodes);
 
-    if(ns->uri && nspace->uri &&
-       raptor_uri_equals(ns->uri, nspace->uri))
-      return 1;
+  if(nodes_count != *nodes_count_p) {
+    context->memory_used += raptor_turtle_term_cost(term);
+    *nodes_count_p = nodes_count;
   }
-
-  nspace = raptor_new_namespace_from_uri(context->nstack,
-                                         nspace->prefix, nspace->uri,
-                                         TURTLE_NAMESPACE_DEPTH);
-  if(!nspace)
-    return 1;
-  
-  raptor_sequence_push(context->namespaces, nspace);
-  return 0;
 }
 
 
-/* add a namespace */
-static int
-raptor_turtle_serialize_declare_namespace(raptor_serializer* serializer, 
-                                          raptor_uri *uri,
-                                          const unsigned char *prefix)
+/* write a run field escaping backslash, tab, newline and NUL */
+static void
+raptor_turtle_run_write_field(raptor_iostream* iostr, int type,
+                              const unsigned char* string, size_t len)
 {
-  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
-  raptor_namespace *ns;
-  int rc;
-  
-  ns = raptor_new_namespace_from_uri(context->nstack, prefix, uri, 
-                                   TURTLE_NAMESPACE_DEPTH);
+  const unsigned char* end = string + len;
 
-  rc = raptor_turtle_serialize_declare_namespace_from_namespace(serializer, ns);
-  raptor_free_namespace(ns);
-  
-  return rc;
-}
+  if(type)
+    raptor_iostream_put_byte(type, iostr);
 
+  while(string < end) {
+    const unsigned char* p = string;
+    int c;
 
-/* start a serialize */
-static int
-raptor_turtle_serialize_start(raptor_serializer* serializer)
-{
-  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
-  raptor_turtle_writer* turtle_writer;
-  int flag;
-  
-  if(context->turtle_writer)
-    raptor_free_turtle_writer(context->turtle_writer);
+    while(p < end && *p != '\\' && *p != '\t' && *p != '\n' && *p)
+      p++;
 
-  flag = RAPTOR_OPTIONS_GET_NUMERIC(serializer, RAPTOR_OPTION_WRITE_BASE_URI);
-  turtle_writer = raptor_new_turtle_writer(serializer->world,
-                                           serializer->base_uri,
-                                           flag,
-                                           context->nstack,
-                                           serializer->iostream);
-  if(!turtle_writer)
-    return 1;
+    if(p > string)
+      raptor_iostream_put_counted_string(string, p - string, iostr);
 
-  raptor_turtle_writer_set_option(turtle_writer,
-                                  RAPTOR_OPTION_WRITER_AUTO_INDENT, 1);
-  raptor_turtle_writer_set_option(turtle_writer,
-                                  RAPTOR_OPTION_WRITER_INDENT_WIDTH, 2);
-  
-  context->turtle_writer = turtle_writer;
+    if(p == end)
+      break;
 
-  return 0;
+    c = *p;
+    raptor_iostream_put_byte('\\', iostr);
+    raptor_iostream_put_byte((c == '\t') ? 't' : (c == '\n') ? 'n' :
+                             (!c) ? '0' : '\\', iostr);
+    string = p + 1;
+  }
+
+  raptor_iostream_put_byte('\t', iostr);
 }
 
+
 static void
-raptor_turtle_ensure_writen_header(raptor_serializer* serializer,
-                                   raptor_turtle_context* context) 
+raptor_turtle_run_write_term(raptor_iostream* iostr, raptor_term* term)
 {
-  int i;
+  const unsigned char* string = NULL;
+  size_t len = 0;
 
-  if(context->written_header)
-    return;
+  switch(term->type) {
+    case RAPTOR_TERM_TYPE_URI:
+      string = raptor_uri_as_counted_string(term->value.uri, &len);
+      raptor_turtle_run_write_field(iostr, 'U', string, len);
+      break;
+
+    case RAPTOR_TERM_TYPE_BLANK:
+      raptor_turtle_run_write_field(iostr, 'B', term->value.blank.string,
+                                    term->value.blank.string_len);
+      break;
+
+    case RAPTOR_TERM_TYPE_LITERAL:
+      raptor_turtle_run_write_field(iostr, 'L', term->value.literal.string,
+                                    term->value.literal.string_len);
+      raptor_turtle_run_write_field(iostr, 0, term->value.literal.language,
+                                    term->value.literal.language_len);
+      if(term->value.literal.datatype)
+        string = raptor_uri_as_counted_string(term->value.literal.datatype,
+                                              &len);
+      raptor_turtle_run_write_field(iostr, 0, string, len);
+      break;
+
+    case RAPTOR_TERM_TYPE_UNKNOWN:
+    default:
+      break;
+  }
+}
+
+
+/* write a triple or, if @predicate is NULL, a count record */
+static void
+raptor_turtle_run_write_record(raptor_iostream* iostr, raptor_term* subject,
+                               raptor_term* predicate, raptor_term* object,
+                               int count)
+{
+  raptor_turtle_run_write_term(iostr, subject);
+
+  if(predicate) {
+    raptor_turtle_run_write_term(iostr, predicate);
+    raptor_turtle_run_write_term(iostr, object);
+  } else {
+    raptor_iostream_put_byte('#', iostr);
+    raptor_iostream_decimal_write(count, iostr);
+    raptor_iostream_put_byte('\t', iostr);
+  }
+
+  raptor_iostream_put_byte('\n', iostr);
+}
+
+
+static void
+raptor_turtle_run_write_subject(raptor_iostream* iostr,
+                                raptor_abbrev_subject* subject)
+{
+  raptor_avltree_iterator* iter;
+
+  iter = raptor_new_avltree_iterator(subject->properties, NULL, NULL, 1);
+  while(iter) {
+    raptor_abbrev_node** nodes;
+
+    nodes = (raptor_abbrev_node**)raptor_avltree_iterator_get(iter);
+    if(nodes)
+      raptor_turtle_run_write_record(iostr, subject->node->term,
+                                     nodes[0]->term, nodes[1]->term, 0);
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+}
+
+
+/* start writing @run to a new temporary file */
+static raptor_iostream*
+raptor_turtle_new_run(raptor_serializer* serializer, raptor_turtle_run* run)
+{
+  memset(run, 0, sizeof(*run));
+
+  run->handle = tmpfile();
+  if(run->handle) {
+    raptor_iostream* iostr;
+
+    iostr = raptor_new_iostream_to_file_handle(serializer->world, run->handle);
+    if(iostr) {
+      /* nothing else writes to the run file so it can be buffered */
+      raptor_iostream_set_write_buffer_size(iostr,
+                                            RAPTOR_IOSTREAM_FILE_BUFFER_SIZE);
+      return iostr;
+    }
+
+    fclose(run->handle);
+    run->handle = NULL;
+  }
+
+  raptor_log_error(serializer->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                   "Cannot create temporary file for Turtle triples");
+  return NULL;
+}
+
+
+/* offset in @run after the bytes written to @iostr or <0 on failure */
+static raptor_turtle_offset
+raptor_turtle_run_tell(raptor_turtle_run* run, raptor_iostream* iostr)
+{
+  /* raptor_iostream_tell() is an unsigned long so ask the file */
+  if(raptor_iostream_flush(iostr))
+    return -1;
+
+  return TURTLE_RUN_TELL(run->handle);
+}
+
+
+/* finish writing @run and free @iostr */
+static int
+raptor_turtle_end_run(raptor_serializer* serializer, raptor_turtle_run* run,
+                      raptor_iostream* iostr)
+{
+  int rc;
+
+  run->end = raptor_turtle_run_tell(run, iostr);
+  rc = (run->end < 0);
+  raptor_free_iostream(iostr);
+
+  if(fflush(run->handle))
+    rc = 1;
+
+  if(rc)
+    raptor_log_error(serializer->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                     "Cannot write temporary file for Turtle triples");
+
+  return rc;
+}
+
+
+static void
+raptor_turtle_record_clear(raptor_turtle_record* record)
+{
+  if(record->subject)
+    raptor_free_term(record->subject);
+  if(record->predicate)
+    raptor_free_term(record->predicate);
+  if(record->object)
+    raptor_free_term(record->object);
+
+  memset(record, 0, sizeof(*record));
+}
+
+
+static int
+raptor_turtle_record_compare(raptor_turtle_record* record1,
+                             raptor_turtle_record* record2)
+{
+  int d;
+
+  d = raptor_term_compare(record1->subject, record2->subject);
+  if(!d)
+    d = raptor_term_compare(record1->predicate, record2->predicate);
+  if(!d)
+    d = raptor_term_compare(record1->object, record2->object);
+
+  return d;
+}
+
+
+/* start reading bytes @start to @end of @run */
+static int
+raptor_turtle_run_reader_init(raptor_turtle_run_reader* reader,
+                              raptor_world* world, raptor_turtle_run* run,
+                              raptor_turtle_offset start,
+                              raptor_turtle_offset end, size_t buffer_size)
+{
+  memset(reader, 0, sizeof(*reader));
+
+  reader->world = world;
+  reader->handle = run->handle;
+  reader->offset = start;
+  reader->end = end;
+
+  reader->buffer = RAPTOR_MALLOC(unsigned char*, buffer_size);
+  reader->buffer_size = buffer_size;
+
+  return !reader->buffer;
+}
+
+
+static void
+raptor_turtle_run_reader_clear(raptor_turtle_run_reader* reader)
+{
+  raptor_turtle_record_clear(&reader->record);
+
+  if(reader->buffer)
+    RAPTOR_FREE(char*, reader->buffer);
+  if(reader->field)
+    RAPTOR_FREE(char*, reader->field);
+
+  memset(reader, 0, sizeof(*reader));
+}
+
+
+static void
+raptor_turtle_free_runs(raptor_turtle_context* context)
+{
+  int i;
+
+  for(i = 0; i < context->runs_count; i++)
+    fclose(context->runs[i].handle);
+
+  if(context->runs) {
+    RAPTOR_FREE(raptor_turtle_run*, context->runs);
+    context->runs = NULL;
+  }
+  context->runs_count = 0;
+  context->runs_size = 0;
+
+  if(context->blank_reader) {
+    raptor_turtle_run_reader_clear(context->blank_reader);
+    RAPTOR_FREE(raptor_turtle_run_reader*, context->blank_reader);
+    context->blank_reader = NULL;
+  }
+
+  if(context->search_steps) {
+    for(i = 0; i < TURTLE_SEARCH_STEPS_SIZE; i++) {
+      if(context->search_steps[i].subject)
+        raptor_free_term(context->search_steps[i].subject);
+    }
+    RAPTOR_FREE(raptor_turtle_search_step*, context->search_steps);
+    context->search_steps = NULL;
+  }
+
+  if(context->blank_run.handle) {
+    fclose(context->blank_run.handle);
+    context->blank_run.handle = NULL;
+  }
+}
+
+
+
+/* file offset of the next byte of @reader */
+static raptor_turtle_offset
+raptor_turtle_run_reader_tell(raptor_turtle_run_reader* reader)
+{
+  return reader->offset -
+         RAPTOR_GOOD_CAST(raptor_turtle_offset, reader->length - reader->pos);
+}
+
+
+static void
+raptor_turtle_run_reader_seek(raptor_turtle_run_reader* reader,
+                              raptor_turtle_offset offset)
+{
+  raptor_turtle_offset buffer_start = reader->offset -
+    RAPTOR_GOOD_CAST(raptor_turtle_offset, reader->length);
+
+  /* keep the buffer if offset is in it */
+  if(offset >= buffer_start && offset < reader->offset) {
+    reader->pos = RAPTOR_GOOD_CAST(size_t, offset - buffer_start);
+    return;
+  }
+
+  reader->offset = offset;
+  reader->length = 0;
+  reader->pos = 0;
+}
+
+
+/* next byte of @reader or EOF at the end of its range */
+static RAPTOR_INLINE int
+raptor_turtle_run_reader_getc(raptor_turtle_run_reader* reader)
+{
+  if(reader->pos == reader->length) {
+    size_t len;
+
+    if(reader->offset >= reader->end)
+      return EOF;
+
+    len = RAPTOR_GOOD_CAST(size_t, reader->end - reader->offset);
+    if(len > reader->buffer_size)
+      len = reader->buffer_size;
+
+    /* the file may be shared with other readers */
+    if(TURTLE_RUN_SEEK(reader->handle, reader->offset))
+      len = 0;
+    else
+      len = fread(reader->buffer, 1, len, reader->handle);
+
+    if(!len) {
+      reader->failed = 1;
+      return EOF;
+    }
+
+    reader->offset += RAPTOR_GOOD_CAST(raptor_turtle_offset, len);
+    reader->length = len;
+    reader->pos = 0;
+  }
+
+  return reader->buffer[reader->pos++];
+}
+
+
+/* make room for one more byte and a NUL in reader->field */
+static int
+raptor_turtle_run_reader_reserve(raptor_turtle_run_reader* reader)
+{
+  if(reader->field_length + 1 >= reader->field_size) {
+    size_t size = reader->field_size ? reader->field_size << 1 : 256;
+    unsigned char* field;
+
+    field = RAPTOR_REALLOC(unsigned char*, reader->field, size);
+    if(!field)
+      return 1;
+
+    reader->field = field;
+    reader->field_size = size;
+  }
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_run_read_field:
+ * @reader: run reader
+ * @start_p: pointer to store the offset of the field in reader->field
+ * @len_p: pointer to store the field length
+ *
+ * INTERNAL - Read and unescape a field, adding it to reader->field
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_run_read_field(raptor_turtle_run_reader* reader,
+                             size_t* start_p, size_t* len_p)
+{
+  size_t start = reader->field_length;
+  int c;
+
+  while(1) {
+    c = raptor_turtle_run_reader_getc(reader);
+    if(c == '\t' || c == '\n' || c == EOF)
+      break;
+
+    if(c == '\\') {
+      c = raptor_turtle_run_reader_getc(reader);
+      if(c == 't')
+        c = '\t';
+      else if(c == 'n')
+        c = '\n';
+      else if(c == '0')
+        c = '\0';
+      else if(c != '\\') {
+        c = EOF;
+        break;
+      }
+    }
+
+    if(raptor_turtle_run_reader_reserve(reader)) {
+      c = EOF;
+      break;
+    }
+    reader->field[reader->field_length++] = RAPTOR_GOOD_CAST(unsigned char, c);
+  }
+
+  if(c != '\t' || raptor_turtle_run_reader_reserve(reader)) {
+    reader->failed = 1;
+    return 1;
+  }
+
+  reader->field[reader->field_length++] = '\0';
+
+  *start_p = start;
+  *len_p = reader->field_length - start - 1;
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_run_read_term:
+ * @reader: run reader
+ * @count_p: pointer to store the count of a count record
+ *
+ * INTERNAL - Read a term or the count of a count record
+ *
+ * Return value: new term or NULL for a count or on failure
+ */
+static raptor_term*
+raptor_turtle_run_read_term(raptor_turtle_run_reader* reader, int* count_p)
+{
+  raptor_world* world = reader->world;
+  raptor_term* term = NULL;
+  raptor_uri* datatype = NULL;
+  size_t start, len;
+  size_t language_start, language_len;
+  size_t datatype_start, datatype_len;
+  unsigned char* value;
+
+  if(raptor_turtle_run_read_field(reader, &start, &len) || !len)
+    goto failed;
+
+  value = &reader->field[start + 1];
+  len--;
+
+  switch(reader->field[start]) {
+    case 'U':
+      term = raptor_new_term_from_counted_uri_string(world, value, len);
+      break;
+
+    case 'B':
+      term = raptor_new_term_from_counted_blank(world, value, len);
+      break;
+
+    case 'L':
+      if(raptor_turtle_run_read_field(reader, &language_start, &language_len) ||
+         raptor_turtle_run_read_field(reader, &datatype_start, &datatype_len))
+        goto failed;
+
+      /* reading the fields may have moved reader->field */
+      value = &reader->field[start + 1];
+
+      if(datatype_len) {
+        datatype = raptor_new_uri_from_counted_string(world,
+                                                      &reader->field[datatype_start],
+                                                      datatype_len);
+        if(!datatype)
+          goto failed;
+      }
+
+      term = raptor_new_term_from_counted_literal(world, value, len, datatype,
+                                                  language_len ? &reader->field[language_start] : NULL,
+                                                  RAPTOR_GOOD_CAST(unsigned char, language_len));
+      if(datatype)
+        raptor_free_uri(datatype);
+      break;
+
+    case '#':
+      *count_p = atoi((const char*)value);
+      return NULL;
+
+    default:
+      break;
+  }
+
+  if(term)
+    return term;
+
+  failed:
+  reader->failed = 1;
+  return NULL;
+}
+
+
+/*
+ * raptor_turtle_run_reader_next:
+ * @reader: run reader
+ *
+ * INTERNAL - Read the next record into reader->record
+ *
+ * Return value: 0 on success, >0 at the end of the range, <0 on failure
+ */
+static int
+raptor_turtle_run_reader_next(raptor_turtle_run_reader* reader)
+{
+  raptor_turtle_record* record = &reader->record;
+
+  raptor_turtle_record_clear(record);
+  reader->has_record = 0;
+
+  if(raptor_turtle_run_reader_tell(reader) >= reader->end)
+    return 1;
+
+  reader->field_length = 0;
+
+  record->subject = raptor_turtle_run_read_term(reader, &record->count);
+  if(record->subject) {
+    record->predicate = raptor_turtle_run_read_term(reader, &record->count);
+    if(record->predicate)
+      record->object = raptor_turtle_run_read_term(reader, &record->count);
+  }
+
+  if(!record->subject || (record->predicate && !record->object) ||
+     raptor_turtle_run_reader_getc(reader) != '\n')
+    reader->failed = 1;
+
+  if(reader->failed) {
+    raptor_log_error(reader->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                     "Cannot read temporary file for Turtle triples");
+    raptor_turtle_record_clear(record);
+    return -1;
+  }
+
+  reader->has_record = 1;
+  return 0;
+}
+
+
+/* restore the heap order of a merge below heap item @i */
+static void
+raptor_turtle_merge_sift(raptor_turtle_merge* merge, int i)
+{
+  raptor_turtle_run_reader** heap = merge->heap;
+
+  while(1) {
+    int least = i;
+    int child = (i << 1) + 1;
+    raptor_turtle_run_reader* reader;
+
+    if(child < merge->heap_count &&
+       raptor_turtle_record_compare(&heap[child]->record,
+                                    &heap[least]->record) < 0)
+      least = child;
+    child++;
+    if(child < merge->heap_count &&
+       raptor_turtle_record_compare(&heap[child]->record,
+                                    &heap[least]->record) < 0)
+      least = child;
+
+    if(least == i)
+      break;
+
+    reader = heap[i];
+    heap[i] = heap[least];
+    heap[least] = reader;
+    i = least;
+  }
+}
+
+
+/*
+ * raptor_turtle_merge_init:
+ * @serializer: #raptor_serializer object
+ * @merge: merge to initialise
+ * @runs: array of runs
+ * @count: number of runs
+ * @part: part of each run to merge
+ *
+ * INTERNAL - Start merging runs.  raptor_turtle_merge_clear() must be called after, even on failure.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_merge_init(raptor_serializer* serializer,
+                         raptor_turtle_merge* merge,
+                         raptor_turtle_run* runs, int count,
+                         raptor_turtle_run_part part)
+{
+  int i;
+
+  memset(merge, 0, sizeof(*merge));
+
+  merge->readers = RAPTOR_CALLOC(raptor_turtle_run_reader*, count,
+                                 sizeof(*merge->readers));
+  merge->heap = RAPTOR_CALLOC(raptor_turtle_run_reader**, count,
+                              sizeof(*merge->heap));
+  if(!merge->readers || !merge->heap)
+    return 1;
+
+  merge->readers_count = count;
+
+  for(i = 0; i < count; i++) {
+    raptor_turtle_run_reader* reader = &merge->readers[i];
+    raptor_turtle_offset start = (part == TURTLE_RUN_BLANKS) ? runs[i].blank : 0;
+    raptor_turtle_offset end = (part == TURTLE_RUN_URIS) ? runs[i].blank : runs[i].end;
+    int rc;
+
+    if(raptor_turtle_run_reader_init(reader, serializer->world, &runs[i],
+                                     start, end, TURTLE_RUN_BUFFER_SIZE))
+      return 1;
+
+    rc = raptor_turtle_run_reader_next(reader);
+    if(rc < 0)
+      return 1;
+
+    if(!rc)
+      merge->heap[merge->heap_count++] = reader;
+  }
+
+  for(i = merge->heap_count >> 1; i-- > 0; )
+    raptor_turtle_merge_sift(merge, i);
+
+  return 0;
+}
+
+
+static void
+raptor_turtle_merge_clear(raptor_turtle_merge* merge)
+{
+  int i;
+
+  if(merge->readers) {
+    for(i = 0; i < merge->readers_count; i++)
+      raptor_turtle_run_reader_clear(&merge->readers[i]);
+    RAPTOR_FREE(raptor_turtle_run_reader*, merge->readers);
+  }
+
+  if(merge->heap)
+    RAPTOR_FREE(raptor_turtle_run_reader**, merge->heap);
+
+  memset(merge, 0, sizeof(*merge));
+}
+
+
+/* read the next record of the reader at the top of the heap */
+static int
+raptor_turtle_merge_advance(raptor_turtle_merge* merge)
+{
+  int rc;
+
+  rc = raptor_turtle_run_reader_next(merge->heap[0]);
+  if(rc < 0)
+    return rc;
+
+  if(rc)
+    merge->heap[0] = merge->heap[--merge->heap_count];
+
+  if(merge->heap_count)
+    raptor_turtle_merge_sift(merge, 0);
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_merge_next:
+ * @merge: merge of runs
+ * @record: record to move the next record into
+ *
+ * INTERNAL - Get the next record of a merge.
+ *
+ * Equal count records from different runs are returned as one with
+ * the counts added and duplicate triples are returned once.
+ *
+ * Return value: 0 on success, >0 at the end, <0 on failure
+ */
+static int
+raptor_turtle_merge_next(raptor_turtle_merge* merge,
+                         raptor_turtle_record* record)
+{
+  raptor_turtle_run_reader* reader;
+
+  if(!merge->heap_count)
+    return 1;
+
+  reader = merge->heap[0];
+  *record = reader->record;
+  memset(&reader->record, 0, sizeof(reader->record));
+
+  if(raptor_turtle_merge_advance(merge))
+    return -1;
+
+  while(merge->heap_count &&
+        !raptor_turtle_record_compare(&merge->heap[0]->record, record)) {
+    record->count += merge->heap[0]->record.count;
+
+    if(raptor_turtle_merge_advance(merge))
+      return -1;
+  }
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_merge_runs:
+ * @serializer: #raptor_serializer object
+ * @first: index of the first run to merge
+ * @part: part of each run to merge
+ * @run: new run to write
+ *
+ * INTERNAL - Merge a part of the runs from @first to the last into a new run
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_merge_runs(raptor_serializer* serializer, int first,
+                         raptor_turtle_run_part part, raptor_turtle_run* run)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_turtle_merge merge;
+  raptor_turtle_record record;
+  raptor_iostream* iostr;
+  int rc;
+
+  memset(&record, 0, sizeof(record));
+
+  iostr = raptor_turtle_new_run(serializer, run);
+  if(!iostr)
+    return 1;
+
+  run->blank = -1;
+
+  rc = raptor_turtle_merge_init(serializer, &merge, &context->runs[first],
+                                context->runs_count - first, part);
+  if(rc)
+    rc = -1;
+
+  while(!rc && !(rc = raptor_turtle_merge_next(&merge, &record))) {
+    if(run->blank < 0 && record.subject->type == RAPTOR_TERM_TYPE_BLANK) {
+      run->blank = raptor_turtle_run_tell(run, iostr);
+      if(run->blank < 0) {
+        rc = -1;
+        break;
+      }
+    }
+
+    raptor_turtle_run_write_record(iostr, record.subject, record.predicate,
+                                   record.object, record.count);
+    raptor_turtle_record_clear(&record);
+  }
+  raptor_turtle_record_clear(&record);
+  raptor_turtle_merge_clear(&merge);
+
+  if(rc > 0 && run->blank < 0) {
+    run->blank = raptor_turtle_run_tell(run, iostr);
+    if(run->blank < 0)
+      rc = -1;
+  }
+
+  /* rc is >0 at the end of the merge */
+  rc = (rc < 0);
+  if(raptor_turtle_end_run(serializer, run, iostr))
+    rc = 1;
+
+  if(rc) {
+    fclose(run->handle);
+    run->handle = NULL;
+  }
+
+  return rc;
+}
+
+
+/* next blank node used as an object from a nodes tree iterator */
+static raptor_abbrev_node*
+raptor_turtle_next_object_blank(raptor_avltree_iterator* iter, int advance)
+{
+  raptor_abbrev_node* node;
+
+  if(!iter || (advance && raptor_avltree_iterator_next(iter)))
+    return NULL;
+
+  while(1) {
+    node = (raptor_abbrev_node*)raptor_avltree_iterator_get(iter);
+    if(!node)
+      return NULL;
+
+    if(node->term->type == RAPTOR_TERM_TYPE_BLANK && node->count_as_object)
+      return node;
+
+    if(raptor_avltree_iterator_next(iter))
+      return NULL;
+  }
+}
+
+
+/*
+ * raptor_turtle_spill:
+ * @serializer: #raptor_serializer object
+ *
+ * INTERNAL - Write the triples in the trees as a new run and empty the trees.
+ *
+ * The object counts of the blank nodes are written as count records
+ * so that they can be added up over all runs.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_spill(raptor_serializer* serializer)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_turtle_run run;
+  raptor_iostream* iostr;
+  raptor_avltree_iterator* iter;
+  raptor_avltree_iterator* nodes_iter;
+  raptor_abbrev_subject* subject;
+  raptor_abbrev_node* node;
+  int rc;
+
+  iostr = raptor_turtle_new_run(serializer, &run);
+  if(!iostr)
+    return 1;
+
+  iter = raptor_new_avltree_iterator(context->subjects, NULL, NULL, 1);
+  while(iter) {
+    subject = (raptor_abbrev_subject*)raptor_avltree_iterator_get(iter);
+    if(subject)
+      raptor_turtle_run_write_subject(iostr, subject);
+    if(raptor_avltree_iterator_next(iter))
+      break;
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+
+  run.blank = raptor_turtle_run_tell(&run, iostr);
+
+  /* blank node subjects and count records in blank node order */
+  nodes_iter = raptor_new_avltree_iterator(context->nodes, NULL, NULL, 1);
+  node = raptor_turtle_next_object_blank(nodes_iter, 0);
+
+  iter = raptor_new_avltree_iterator(context->blanks, NULL, NULL, 1);
+  subject = iter ? (raptor_abbrev_subject*)raptor_avltree_iterator_get(iter) : NULL;
+
+  while(subject || node) {
+    if(node &&
+       (!subject || raptor_abbrev_node_compare(node, subject->node) <= 0)) {
+      raptor_turtle_run_write_record(iostr, node->term, NULL, NULL,
+                                     node->count_as_object);
+      node = raptor_turtle_next_object_blank(nodes_iter, 1);
+    } else {
+      raptor_turtle_run_write_subject(iostr, subject);
+      if(raptor_avltree_iterator_next(iter))
+        subject = NULL;
+      else
+        subject = (raptor_abbrev_subject*)raptor_avltree_iterator_get(iter);
+    }
+  }
+  if(iter)
+    raptor_free_avltree_iterator(iter);
+  if(nodes_iter)
+    raptor_free_avltree_iterator(nodes_iter);
+
+  rc = raptor_turtle_end_run(serializer, &run, iostr);
+  if(run.blank < 0)
+    rc = 1;
+
+  if(!rc && context->runs_count == context->runs_size) {
+    int size = context->runs_size ? context->runs_size << 1 : 8;
+    raptor_turtle_run* runs;
+
+    runs = RAPTOR_REALLOC(raptor_turtle_run*, context->runs,
+                          size * sizeof(*runs));
+    if(runs) {
+      context->runs = runs;
+      context->runs_size = size;
+    } else
+      rc = 1;
+  }
+
+  if(rc) {
+    fclose(run.handle);
+    return 1;
+  }
+
+  context->runs[context->runs_count++] = run;
+
+  raptor_turtle_free_trees(context);
+  if(raptor_turtle_new_trees(context))
+    return 1;
+
+  /* merge the last runs while there are enough of the same length */
+  while(context->runs_count >= TURTLE_RUN_MERGE_WIDTH) {
+    int first = context->runs_count - TURTLE_RUN_MERGE_WIDTH;
+    int level = context->runs[first].level;
+    int i;
+
+    if(context->runs[context->runs_count - 1].level != level)
+      break;
+
+    if(raptor_turtle_merge_runs(serializer, first, TURTLE_RUN_ALL, &run))
+      return 1;
+
+    for(i = first; i < context->runs_count; i++)
+      fclose(context->runs[i].handle);
+
+    run.level = level + 1;
+    context->runs[first] = run;
+    context->runs_count = first + 1;
+  }
+
+  return 0;
+}
+
+
+/* add a record read from a run to @subject */
+static int
+raptor_turtle_spill_add_record(raptor_turtle_context* context,
+                               raptor_abbrev_subject* subject,
+                               raptor_turtle_record* record)
+{
+  raptor_abbrev_node* predicate;
+  raptor_abbrev_node* object;
+
+  if(!record->predicate) {
+    subject->node->count_as_object = record->count;
+    return 0;
+  }
+
+  predicate = raptor_abbrev_node_lookup(context->nodes, record->predicate);
+  object = raptor_abbrev_node_lookup(context->nodes, record->object);
+  if(!predicate || !object)
+    return 1;
+
+  return (raptor_abbrev_subject_add_property(subject, predicate, object) < 0);
+}
+
+
+/*
+ * raptor_turtle_spill_load_blank:
+ * @serializer: #raptor_serializer object
+ * @node: blank node
+ * @always: non-0 to add the triples even if @node cannot be inlined
+ *
+ * INTERNAL - Read a blank node from the merged blank node subjects.
+ *
+ * Sets the object count of @node and, if it is used once as an
+ * object or @always is set, adds it as a subject to the blanks tree.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_spill_load_blank(raptor_serializer* serializer,
+                               raptor_abbrev_node* node, int always)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_turtle_run_reader* reader = context->blank_reader;
+  raptor_turtle_record* record = &reader->record;
+  raptor_abbrev_subject* subject = NULL;
+  raptor_turtle_offset low = 0;
+  raptor_turtle_offset high = context->blank_run.end;
+  int step_index = 0;
+  int rc;
+
+  /* binary search for the first record with a subject not before node */
+  while(high - low > TURTLE_RUN_SEARCH_SCAN_SIZE) {
+    raptor_turtle_search_step* step = NULL;
+    raptor_turtle_search_step found;
+
+    if(step_index < TURTLE_SEARCH_STEPS_SIZE)
+      step = &context->search_steps[step_index];
+
+    if(step && step->subject)
+      found = *step;
+    else {
+      raptor_turtle_offset mid = low + ((high - low) >> 1);
+      int c;
+
+      /* records are lines so skip to the start of the next one */
+      raptor_turtle_run_reader_seek(reader, mid - 1);
+      do {
+        c = raptor_turtle_run_reader_getc(reader);
+      } while(c != '\n' && c != EOF);
+
+      found.start = raptor_turtle_run_reader_tell(reader);
+      if(found.start >= high)
+        found.start = low;
+
+      raptor_turtle_run_reader_seek(reader, found.start);
+      if(raptor_turtle_run_reader_next(reader))
+        return 1;
+
+      found.subject = record->subject;
+      found.end = raptor_turtle_run_reader_tell(reader);
+
+      if(step) {
+        *step = found;
+        step->subject = raptor_term_copy(found.subject);
+      }
+    }
+
+    if(raptor_term_compare(found.subject, node->term) < 0) {
+      low = found.end;
+      step_index = (step_index << 1) + 2;
+    } else {
+      high = found.start;
+      step_index = (step_index << 1) + 1;
+    }
+  }
+
+  /* read through the rest of the range */
+  raptor_turtle_run_reader_seek(reader, low);
+  do {
+    rc = raptor_turtle_run_reader_next(reader);
+  } while(!rc && raptor_term_compare(record->subject, node->term) < 0);
+
+  for(; !rc && raptor_term_equals(record->subject, node->term);
+      rc = raptor_turtle_run_reader_next(reader)) {
+    if(!record->predicate)
+      node->count_as_object = record->count;
+    else if(always || node->count_as_object == 1) {
+      if(!subject) {
+        subject = raptor_abbrev_subject_lookup(context->nodes,
+                                               context->subjects,
+                                               context->blanks, node->term);
+        if(!subject)
+          return 1;
+      }
+
+      if(raptor_turtle_spill_add_record(context, subject, record))
+        return 1;
+    } else
+      break;
+  }
+
+  return (rc < 0);
+}
+
+
+/* find a blank node subject, reading it from the runs if spilled */
+static raptor_abbrev_subject*
+raptor_turtle_find_blank(raptor_serializer* serializer,
+                         raptor_abbrev_node* node)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_abbrev_subject* subject;
+
+  subject = raptor_abbrev_subject_find(context->blanks, node->term);
+  if(!subject && context->blank_reader &&
+     !raptor_turtle_spill_load_blank(serializer, node, 1))
+    subject = raptor_abbrev_subject_find(context->blanks, node->term);
+
+  return subject;
+}
+
+
+/*
+ * raptor_turtle_spill_emit_merge:
+ * @serializer: #raptor_serializer object
+ * @merge: merge of runs
+ *
+ * INTERNAL - Emit each subject of a merge once all its triples are read
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_spill_emit_merge(raptor_serializer* serializer,
+                               raptor_turtle_merge* merge)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_abbrev_subject* subject = NULL;
+  raptor_turtle_record record;
+  int rc;
+
+  memset(&record, 0, sizeof(record));
+
+  while(1) {
+    rc = raptor_turtle_merge_next(merge, &record);
+    if(rc)
+      break;
+
+    if(subject && !raptor_term_equals(subject->node->term, record.subject)) {
+      rc = raptor_turtle_emit_subject(serializer, subject, 0);
+      subject = NULL;
+
+      /* only this subject and any inlined blank nodes are in the trees */
+      raptor_turtle_free_trees(context);
+      if(rc || raptor_turtle_new_trees(context)) {
+        rc = -1;
+        break;
+      }
+    }
+
+    if(!subject) {
+      subject = raptor_abbrev_subject_lookup(context->nodes,
+                                             context->subjects,
+                                             context->blanks, record.subject);
+      if(!subject) {
+        rc = -1;
+        break;
+      }
+    }
+
+    if(raptor_turtle_spill_add_record(context, subject, &record)) {
+      rc = -1;
+      break;
+    }
+    raptor_turtle_record_clear(&record);
+  }
+  raptor_turtle_record_clear(&record);
+
+  if(rc < 0)
+    return 1;
+
+  rc = 0;
+  if(subject) {
+    rc = raptor_turtle_emit_subject(serializer, subject, 0);
+
+    raptor_turtle_free_trees(context);
+    if(raptor_turtle_new_trees(context))
+      rc = 1;
+  }
+
+  return rc;
+}
+
+
+/*
+ * raptor_turtle_spill_emit:
+ * @serializer: #raptor_serializer object
+ *
+ * INTERNAL - Emit Turtle for all triples when some were spilled to runs
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_spill_emit(raptor_serializer* serializer)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_turtle_merge merge;
+  int rc = 0;
+
+  if(raptor_avltree_size(context->nodes))
+    rc = raptor_turtle_spill(serializer);
+
+  if(!rc)
+    rc = raptor_turtle_merge_runs(serializer, 0, TURTLE_RUN_BLANKS,
+                                  &context->blank_run);
+
+  if(!rc) {
+    context->blank_reader = RAPTOR_CALLOC(raptor_turtle_run_reader*, 1,
+                                          sizeof(*context->blank_reader));
+    context->search_steps = RAPTOR_CALLOC(raptor_turtle_search_step*,
+                                          TURTLE_SEARCH_STEPS_SIZE,
+                                          sizeof(*context->search_steps));
+    if(!context->blank_reader || !context->search_steps ||
+       raptor_turtle_run_reader_init(context->blank_reader, serializer->world,
+                                     &context->blank_run, 0,
+                                     context->blank_run.end,
+                                     TURTLE_RUN_SEARCH_BUFFER_SIZE))
+      rc = 1;
+  }
+
+  if(!rc) {
+    rc = raptor_turtle_merge_init(serializer, &merge, context->runs,
+                                  context->runs_count, TURTLE_RUN_URIS);
+    if(!rc)
+      rc = raptor_turtle_spill_emit_merge(serializer, &merge);
+    raptor_turtle_merge_clear(&merge);
+  }
+
+  if(!rc) {
+    rc = raptor_turtle_merge_init(serializer, &merge, &context->blank_run, 1,
+                                  TURTLE_RUN_ALL);
+    if(!rc)
+      rc = raptor_turtle_spill_emit_merge(serializer, &merge);
+    raptor_turtle_merge_clear(&merge);
+  }
+
+  raptor_turtle_free_runs(context);
+
+  return rc;
+}
+
+
+/*
+ * raptor serializer Turtle implementation
+ */
+
+
+/* create a new serializer */
+static int
+raptor_turtle_serialize_init(raptor_serializer* serializer, const char *name)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_uri *rdf_type_uri;
+
+  context->nstack = raptor_new_namespaces(serializer->world, 1);
+  if(!context->nstack)
+    return 1;
+  context->rdf_nspace = raptor_new_namespace(context->nstack,
+                                             (const unsigned char*)"rdf",
+                                             (const unsigned char*)raptor_rdf_namespace_uri,
+                                              0);
+
+  context->namespaces = raptor_new_sequence(NULL, NULL);
+
+  (void)raptor_turtle_new_trees(context);
+
+  rdf_type_uri = raptor_new_uri_for_rdf_concept(serializer->world,
+                                                (const unsigned char*)"type");
+  if(rdf_type_uri) {
+    raptor_term* uri_term;
+    uri_term = raptor_new_term_from_uri(serializer->world,
+                                        rdf_type_uri);
+    raptor_free_uri(rdf_type_uri);
+    context->rdf_type = raptor_new_abbrev_node(serializer->world, uri_term);
+    raptor_free_term(uri_term);
+  } else
+    context->rdf_type = NULL;
+
+  context->rdf_xml_literal_uri = raptor_new_uri(serializer->world, raptor_xml_literal_datatype_uri_string);
+  context->rdf_first_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#first");
+  context->rdf_rest_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#rest");
+  context->rdf_nil_uri = raptor_new_uri(serializer->world, (const unsigned char*)"http://www.w3.org/1999/02/22-rdf-syntax-ns#nil");
+
+  if(!context->rdf_nspace || !context->namespaces ||
+     !context->subjects || !context->blanks || !context->nodes ||
+     !context->rdf_xml_literal_uri || !context->rdf_first_uri ||
+     !context->rdf_rest_uri || !context->rdf_nil_uri || !context->rdf_type)
+  {
+    raptor_turtle_serialize_terminate(serializer);
+    return 1;
+  }
+
+  /* Note: item 0 in the list is rdf:RDF's namespace */
+  if(raptor_sequence_push(context->namespaces, context->rdf_nspace)) {
+    raptor_turtle_serialize_terminate(serializer);
+    return 1;
+  }
+
+  return 0;
+}
+
+
+/* destroy a serializer */
+static void
+raptor_turtle_serialize_terminate(raptor_serializer* serializer)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+
+  if(context->turtle_writer) {
+    raptor_free_turtle_writer(context->turtle_writer);
+    context->turtle_writer = NULL;
+  }
+
+  if(context->rdf_nspace) {
+    raptor_free_namespace(context->rdf_nspace);
+    context->rdf_nspace = NULL;
+  }
+
+  if(context->namespaces) {
+    int i;
+
+    /* Note: item 0 in the list is rdf:RDF's namespace and freed above */
+    for(i = 1; i< raptor_sequence_size(context->namespaces); i++) {
+      raptor_namespace* ns;
+      ns =(raptor_namespace*)raptor_sequence_get_at(context->namespaces, i);
+      if(ns)
+        raptor_free_namespace(ns);
+    }
+    raptor_free_sequence(context->namespaces);
+    context->namespaces = NULL;
+  }
+
+  raptor_turtle_free_trees(context);
+
+  raptor_turtle_free_runs(context);
+
+  if(context->sorted_subject) {
+    raptor_free_term(context->sorted_subject);
+    context->sorted_subject = NULL;
+  }
+
+  if(context->nstack) {
+    raptor_free_namespaces(context->nstack);
+    context->nstack = NULL;
+  }
+
+  if(context->rdf_type) {
+    raptor_free_abbrev_node(context->rdf_type);
+    context->rdf_type = NULL;
+  }
+
+  if(context->rdf_xml_literal_uri) {
+    raptor_free_uri(context->rdf_xml_literal_uri);
+    context->rdf_xml_literal_uri = NULL;
+  }
+
+  if(context->rdf_first_uri) {
+    raptor_free_uri(context->rdf_first_uri);
+    context->rdf_first_uri = NULL;
+  }
+
+  if(context->rdf_rest_uri) {
+    raptor_free_uri(context->rdf_rest_uri);
+    context->rdf_rest_uri = NULL;
+  }
+
+  if(context->rdf_nil_uri) {
+    raptor_free_uri(context->rdf_nil_uri);
+    context->rdf_nil_uri = NULL;
+  }
+}
+
+
+#define TURTLE_NAMESPACE_DEPTH 0
+
+/* add a namespace */
+static int
+raptor_turtle_serialize_declare_namespace_from_namespace(raptor_serializer* serializer, 
+                                                         raptor_namespace *nspace)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  int i;
+ 
+  if(context->written_header)
+    return 1;
+  
+  for(i = 0; i< raptor_sequence_size(context->namespaces); i++) {
+    raptor_namespace* ns;
+    ns = (raptor_namespace*)raptor_sequence_get_at(context->namespaces, i);
+
+    /* If prefix is already declared, ignore it */
+    if(!ns->prefix && !nspace->prefix)
+      return 1;
+    
+    if(ns->prefix && nspace->prefix && 
+       !strcmp((const char*)ns->prefix, (const char*)nspace->prefix))
+      return 1;
+
+    if(ns->uri && nspace->uri &&
+       raptor_uri_equals(ns->uri, nspace->uri))
+      return 1;
+  }
+
+  nspace = raptor_new_namespace_from_uri(context->nstack,
+                                         nspace->prefix, nspace->uri,
+                                         TURTLE_NAMESPACE_DEPTH);
+  if(!nspace)
+    return 1;
+  
+  raptor_sequence_push(context->namespaces, nspace);
+  return 0;
+}
+
+
+/* add a namespace */
+static int
+raptor_turtle_serialize_declare_namespace(raptor_serializer* serializer, 
+                                          raptor_uri *uri,
+                                          const unsigned char *prefix)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_namespace *ns;
+  int rc;
+  
+  ns = raptor_new_namespace_from_uri(context->nstack, prefix, uri, 
+                                   TURTLE_NAMESPACE_DEPTH);
+
+  rc = raptor_turtle_serialize_declare_namespace_from_namespace(serializer, ns);
+  raptor_free_namespace(ns);
+  
+  return rc;
+}
+
+
+/* start a serialize */
+static int
+raptor_turtle_serialize_start(raptor_serializer* serializer)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_turtle_writer* turtle_writer;
+  int flag;
+  int memory_limit;
+  
+  if(context->turtle_writer)
+    raptor_free_turtle_writer(context->turtle_writer);
+
+  memory_limit = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                            RAPTOR_OPTION_SERIALIZE_MEMORY_LIMIT);
+  context->memory_limit = (memory_limit > 0) ? (size_t)memory_limit << 10 : 0;
+
+  /* subject groups without blank nodes are written when the next
+   * starts; the groups kept back are not spilled */
+  context->sorted_input = RAPTOR_OPTIONS_GET_NUMERIC(serializer,
+                                                     RAPTOR_OPTION_SERIALIZE_SORTED_INPUT);
+  if(context->sorted_input)
+    context->memory_limit = 0;
+
+  flag = RAPTOR_OPTIONS_GET_NUMERIC(serializer, RAPTOR_OPTION_WRITE_BASE_URI);
+  turtle_writer = raptor_new_turtle_writer(serializer->world,
+                                           serializer->base_uri,
+                                           flag,
+                                           context->nstack,
+                                           serializer->iostream);
+  if(!turtle_writer)
+    return 1;
+
+  raptor_turtle_writer_set_option(turtle_writer,
+                                  RAPTOR_OPTION_WRITER_AUTO_INDENT, 1);
+  raptor_turtle_writer_set_option(turtle_writer,
+                                  RAPTOR_OPTION_WRITER_INDENT_WIDTH, 2);
+  
+  context->turtle_writer = turtle_writer;
+
+  return 0;
+}
+
+static void
+raptor_turtle_ensure_writen_header(raptor_serializer* serializer,
+                                   raptor_turtle_context* context) 
+{
+  int i;
+
+  if(context->written_header)
+    return;
   
   if(!context->turtle_writer)
     return;
@@ -1045,6 +2511,49 @@ raptor_turtle_ensure_writen_header(raptor_serializer* serializer,
   context->written_header = 1;
 }
 
+/*
+ * raptor_turtle_sorted_subject:
+ * @serializer: #raptor_serializer object
+ * @term: subject of the next triple
+ *
+ * INTERNAL - With sorted input, emit and free the triples of the
+ * previous subject if @term starts a new subject group
+ *
+ * A subject group that is a blank node or has blank node objects is
+ * kept back until the end, when the use counts of the blank nodes
+ * are known and those used once can be nested as usual.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_sorted_subject(raptor_serializer* serializer, raptor_term* term)
+{
+  raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  raptor_abbrev_subject* subject;
+
+  if(context->sorted_subject) {
+    if(raptor_term_equals(context->sorted_subject, term))
+      return 0;
+
+    subject = raptor_abbrev_subject_find(context->subjects,
+                                         context->sorted_subject);
+    if(subject && !raptor_abbrev_subject_uses_blank(subject)) {
+      raptor_turtle_ensure_writen_header(serializer, context);
+      if(raptor_turtle_emit_subject(serializer, subject, 0) ||
+         raptor_abbrev_subject_delete(context->nodes, context->subjects,
+                                      subject))
+        return 1;
+    }
+
+    raptor_free_term(context->sorted_subject);
+  }
+
+  context->sorted_subject = raptor_term_copy(term);
+
+  return !context->sorted_subject;
+}
+
+
 /* serialize a statement */
 static int
 raptor_turtle_serialize_statement(raptor_serializer* serializer, 
@@ -1056,6 +2565,7 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
   raptor_abbrev_node* object = NULL;
   int rv;
   raptor_term_type object_type;
+  int nodes_count;
 
   if(!(statement->subject->type == RAPTOR_TERM_TYPE_URI ||
        statement->subject->type == RAPTOR_TERM_TYPE_BLANK)) {
@@ -1065,12 +2575,19 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
     return 1;
   }  
 
+  if(context->sorted_input &&
+     raptor_turtle_sorted_subject(serializer, statement->subject))
+    return 1;
+
+  nodes_count = raptor_avltree_size(context->nodes);
+
   subject = raptor_abbrev_subject_lookup(context->nodes, context->subjects,
                                          context->blanks,
                                          statement->subject);
   if(!subject) {
     return 1;
   }
+  raptor_turtle_count_node(context, &nodes_count, statement->subject);
 
   object_type = statement->object->type;
 
@@ -1086,12 +2603,17 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
   object = raptor_abbrev_node_lookup(context->nodes, statement->object);
   if(!object)
     return 1;          
+  raptor_turtle_count_node(context, &nodes_count, statement->object);
 
 
   if(statement->predicate->type == RAPTOR_TERM_TYPE_URI) {
     predicate = raptor_abbrev_node_lookup(context->nodes, statement->predicate);
     if(!predicate)
       return 1;
+    raptor_turtle_count_node(context, &nodes_count, statement->predicate);
+
+    if(!raptor_avltree_size(subject->properties))
+      context->memory_used += TURTLE_SUBJECT_COST;
 	      
     rv = raptor_abbrev_subject_add_property(subject, predicate, object);
     if(rv < 0) {
@@ -1100,6 +2622,8 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
                                  subject);
       return rv;
     }
+    if(!rv)
+      context->memory_used += TURTLE_PROPERTY_COST;
   
   } else {
     raptor_log_error_formatted(serializer->world, RAPTOR_LOG_LEVEL_ERROR, NULL,
@@ -1112,6 +2636,9 @@ raptor_turtle_serialize_statement(raptor_serializer* serializer,
      object_type == RAPTOR_TERM_TYPE_BLANK)
     object->count_as_object++;
 
+  if(context->memory_limit && context->memory_used > context->memory_limit)
+    return raptor_turtle_spill(serializer);
+
   return 0;
 }
 
@@ -1121,15 +2648,24 @@ static int
 raptor_turtle_serialize_end(raptor_serializer* serializer)
 {
   raptor_turtle_context* context = (raptor_turtle_context*)serializer->context;
+  int rc = 0;
   
   raptor_turtle_ensure_writen_header(serializer, context);
   
-  raptor_turtle_emit(serializer);  
+  if(context->runs_count)
+    rc = raptor_turtle_spill_emit(serializer);
+  else
+    raptor_turtle_emit(serializer);  
 
   /* reset serializer for reuse */
   context->written_header = 0;
 
-  return 0;
+  if(context->sorted_subject) {
+    raptor_free_term(context->sorted_subject);
+    context->sorted_subject = NULL;
+  }
+
+  return rc;
 }
 
 
@@ -55,31 +55,72 @@
  *  Destroy Set
  *  Check a (base, ID) pair present add it if not, return if added/not
  *
+ * The set is one hash table keyed on (base URI, ID).  Base URIs are
+ * kept once each in an array, found by a small hash table of their
+ * strings, and entries refer to them by index; the index of the last
+ * base URI used is remembered since xml:base changes much less often
+ * than rdf:IDs are added.  ID strings are copied into large pool
+ * blocks rather than allocated one by one.
  */
 
-struct raptor_base_id_set_s
-{
-  raptor_world* world;
+/* Initial size of the hash table; must be a power of 2 */
+#define RAPTOR_ID_SET_INITIAL_SIZE 64
 
-  /* The base URI of this set of IDs */
-  raptor_uri *uri;
-  
-  /* neighbour ID sets */
-  struct raptor_base_id_set_s* prev;
-  struct raptor_base_id_set_s* next;
+/* Minimum size of a pool block for ID strings */
+#define RAPTOR_ID_SET_POOL_BLOCK_SIZE 4096
+
+
+typedef struct raptor_id_set_pool_block_s raptor_id_set_pool_block;
 
-  /* binary tree */
-  raptor_avltree* tree;
+struct raptor_id_set_pool_block_s {
+  raptor_id_set_pool_block* next;
+
+  /* size of storage in this block and how much is used */
+  size_t size;
+  size_t used;
+
+  /* storage */
+  unsigned char data[1];
 };
-typedef struct raptor_base_id_set_s raptor_base_id_set;
+
+
+typedef struct
+{
+  /* ID string in a pool block; NULL if the table slot is empty */
+  const unsigned char* id;
+  size_t id_len;
+
+  /* index of the ID's base URI in the set bases array */
+  unsigned int base;
+
+  /* hash of (base, ID) */
+  unsigned int hash;
+} raptor_id_set_entry;
 
 
 struct raptor_id_set_s
 {
   raptor_world* world;
 
-  /* start of trees, 1 per base URI */
-  struct raptor_base_id_set_s* first;
+  /* base URIs of the IDs in the set (references held) */
+  raptor_uri** bases;
+  unsigned int bases_count;
+  unsigned int bases_size;
+
+  /* open addressing hash table of (index in bases + 1) or 0 if the
+   * slot is empty, keyed on the base URI string; twice bases_size */
+  unsigned int* bases_index;
+
+  /* index in bases of the base URI last added to */
+  unsigned int last_base;
+
+  /* open addressing hash table with linear probing, size is a power of 2 */
+  raptor_id_set_entry* entries;
+  size_t size;
+  size_t count;
+
+  /* pool blocks holding the ID strings; first is the current one */
+  raptor_id_set_pool_block* pool;
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   int hits;
@@ -107,25 +148,16 @@ raptor_new_id_set(raptor_world* world)
 
   set->world = world;
 
-  return set;
-}
-
+  set->entries = RAPTOR_CALLOC(raptor_id_set_entry*,
+                               RAPTOR_ID_SET_INITIAL_SIZE,
+                               sizeof(raptor_id_set_entry));
+  if(!set->entries) {
+    RAPTOR_FREE(raptor_id_set, set);
+    return NULL;
+  }
+  set->size = RAPTOR_ID_SET_INITIAL_SIZE;
 
-/**
- * raptor_free_base_id_set:
- * @set: #raptor_base_id_set
- *
- * INTERNAL - Destructor - Free a Base ID Set.
- *
- **/
-static void
-raptor_free_base_id_set(raptor_base_id_set *base) 
-{
-  if(base->tree)
-    raptor_free_avltree(base->tree);
-  if(base->uri)
-    raptor_free_uri(base->uri);
-  RAPTOR_FREE(raptor_base_id_set, base);
+  return set;
 }
 
 
@@ -139,20 +171,213 @@ raptor_free_base_id_set(raptor_base_id_set *base)
 void
 raptor_free_id_set(raptor_id_set *set) 
 {
-  raptor_base_id_set *base;
+  raptor_id_set_pool_block* block;
+  unsigned int i;
 
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN(set, raptor_id_set);
 
-  base = set->first;
-  while(base) {
-    raptor_base_id_set *next = base->next;
-    raptor_free_base_id_set(base);
-    base = next;
+  for(block = set->pool; block; ) {
+    raptor_id_set_pool_block* next = block->next;
+    RAPTOR_FREE(raptor_id_set_pool_block, block);
+    block = next;
   }
+
+  for(i = 0; i < set->bases_count; i++)
+    raptor_free_uri(set->bases[i]);
+  if(set->bases)
+    RAPTOR_FREE(raptor_uri_array, set->bases);
+  if(set->bases_index)
+    RAPTOR_FREE(raptor_id_set_index_array, set->bases_index);
+
+  RAPTOR_FREE(raptor_id_set_entry_array, set->entries);
   RAPTOR_FREE(raptor_id_set, set);
 }
 
 
+/*
+ * raptor_id_set_hash_uri:
+ * @uri: URI
+ *
+ * INTERNAL - 32 bit FNV-1a hash of a URI string
+ *
+ * Return value: hash
+ */
+static unsigned int
+raptor_id_set_hash_uri(raptor_uri* uri)
+{
+  size_t len;
+  const unsigned char* string = raptor_uri_as_counted_string(uri, &len);
+  unsigned int hash = 2166136261U;
+
+  while(len--) {
+    hash ^= *string++;
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+
+/*
+ * raptor_id_set_get_base:
+ * @set: #raptor_id_set
+ * @base_uri: base URI
+ *
+ * INTERNAL - Get the index of a base URI in the set, adding it if new
+ *
+ * Return value: index or <0 on failure
+ */
+static int
+raptor_id_set_get_base(raptor_id_set* set, raptor_uri* base_uri)
+{
+  unsigned int hash;
+  unsigned int mask;
+  unsigned int i;
+  unsigned int index;
+
+  if(set->bases_count && set->bases[set->last_base] == base_uri)
+    return RAPTOR_BAD_CAST(int, set->last_base);
+
+  hash = raptor_id_set_hash_uri(base_uri);
+
+  if(set->bases_size) {
+    mask = (set->bases_size << 1) - 1;
+    for(i = hash & mask; (index = set->bases_index[i]); i = (i + 1) & mask) {
+      if(raptor_uri_equals(set->bases[index - 1], base_uri)) {
+        set->last_base = index - 1;
+        return RAPTOR_BAD_CAST(int, set->last_base);
+      }
+    }
+  }
+
+  if(set->bases_count == set->bases_size) {
+    unsigned int new_size = set->bases_size ? set->bases_size << 1 : 8;
+    raptor_uri** new_bases;
+    unsigned int* new_index;
+
+    new_index = RAPTOR_CALLOC(unsigned int*, new_size << 1,
+                              sizeof(unsigned int));
+    if(!new_index)
+      return -1;
+
+    new_bases = RAPTOR_REALLOC(raptor_uri**, set->bases,
+                               new_size * sizeof(raptor_uri*));
+    if(!new_bases) {
+      RAPTOR_FREE(raptor_id_set_index_array, new_index);
+      return -1;
+    }
+
+    /* Rehashing the few base URI strings is cheap and rare */
+    mask = (new_size << 1) - 1;
+    for(index = 0; index < set->bases_count; index++) {
+      for(i = raptor_id_set_hash_uri(new_bases[index]) & mask;
+          new_index[i];
+          i = (i + 1) & mask)
+        ;
+      new_index[i] = index + 1;
+    }
+
+    if(set->bases_index)
+      RAPTOR_FREE(raptor_id_set_index_array, set->bases_index);
+    set->bases = new_bases;
+    set->bases_index = new_index;
+    set->bases_size = new_size;
+  }
+
+  mask = (set->bases_size << 1) - 1;
+  for(i = hash & mask; set->bases_index[i]; i = (i + 1) & mask)
+    ;
+
+  set->bases[set->bases_count] = raptor_uri_copy(base_uri);
+  set->last_base = set->bases_count++;
+  set->bases_index[i] = set->bases_count;
+
+  return RAPTOR_BAD_CAST(int, set->last_base);
+}
+
+
+/*
+ * raptor_id_set_pool_copy:
+ * @set: #raptor_id_set
+ * @id: string
+ * @id_len: length of string
+ *
+ * INTERNAL - Copy a string into the set's pool
+ *
+ * Return value: pooled copy (NUL terminated) or NULL on failure
+ */
+static const unsigned char*
+raptor_id_set_pool_copy(raptor_id_set* set, const unsigned char* id,
+                        size_t id_len)
+{
+  raptor_id_set_pool_block* block = set->pool;
+  unsigned char* copy;
+
+  if(!block || block->size - block->used < id_len + 1) {
+    size_t size = RAPTOR_ID_SET_POOL_BLOCK_SIZE;
+
+    if(id_len + 1 > size)
+      size = id_len + 1;
+
+    block = (raptor_id_set_pool_block*)RAPTOR_MALLOC(raptor_id_set_pool_block*,
+                                                     sizeof(*block) + size);
+    if(!block)
+      return NULL;
+    block->size = size;
+    block->used = 0;
+    block->next = set->pool;
+    set->pool = block;
+  }
+
+  copy = block->data + block->used;
+  memcpy(copy, id, id_len);
+  copy[id_len] = '\0';
+  block->used += id_len + 1;
+
+  return copy;
+}
+
+
+/*
+ * raptor_id_set_grow:
+ * @set: #raptor_id_set
+ *
+ * INTERNAL - Double the size of the hash table
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_id_set_grow(raptor_id_set* set)
+{
+  size_t new_size = set->size << 1;
+  size_t mask = new_size - 1;
+  raptor_id_set_entry* new_entries;
+  size_t i;
+
+  new_entries = RAPTOR_CALLOC(raptor_id_set_entry*, new_size,
+                              sizeof(raptor_id_set_entry));
+  if(!new_entries)
+    return 1;
+
+  for(i = 0; i < set->size; i++) {
+    raptor_id_set_entry* entry = &set->entries[i];
+    size_t j;
+
+    if(!entry->id)
+      continue;
+
+    for(j = entry->hash & mask; new_entries[j].id; j = (j + 1) & mask)
+      ;
+    new_entries[j] = *entry;
+  }
+
+  RAPTOR_FREE(raptor_id_set_entry_array, set->entries);
+  set->entries = new_entries;
+  set->size = new_size;
+
+  return 0;
+}
+
 
 /**
  * raptor_id_set_add:
@@ -169,74 +394,58 @@ int
 raptor_id_set_add(raptor_id_set* set, raptor_uri *base_uri,
                   const unsigned char *id, size_t id_len)
 {
-  raptor_base_id_set *base;
-  char* item;
-  
+  raptor_id_set_entry* entry;
+  int base;
+  unsigned int hash;
+  size_t i;
+  size_t mask;
+
   if(!base_uri || !id || !id_len)
     return -1;
 
-  base = set->first;
-  while(base) {
-    if(raptor_uri_equals(base->uri, base_uri))
-      break;
-    base = base->next;
-  }
-
-  if(!base) {
-    /* a set for this base_uri not found */
-    base = RAPTOR_CALLOC(raptor_base_id_set*, 1, sizeof(*base));
-    if(!base)
-      return -1;
-
-    base->world = set->world;
+  base = raptor_id_set_get_base(set, base_uri);
+  if(base < 0)
+    return -1;
 
-    base->uri = raptor_uri_copy(base_uri);
+  /* keep the load factor at most 3/4 after adding; grow first so a
+   * failure leaves the set unchanged */
+  if((set->count + 1) * 4 > set->size * 3 && raptor_id_set_grow(set))
+    return -1;
 
-    base->tree = raptor_new_avltree((raptor_data_compare_handler)strcmp,
-                                    free, 0);
-  
-    /* Add to the start of the list */
-    if(set->first)
-      set->first->prev = base;
-    /* base->prev = NULL; */
-    base->next = set->first;
-
-    set->first = base;
-  } else {
-    /* If not at the start of the list, move there */
-    if(base != set->first) {
-      /* remove from the list */
-      base->prev->next = base->next;
-      if(base->next)
-        base->next->prev = base->prev;
-      /* add at the start of the list */
-      set->first->prev = base;
-      base->prev = NULL;
-      base->next = set->first;
-    }
+  /* 32 bit FNV-1a over the base index and ID */
+  hash = (2166136261U ^ RAPTOR_GOOD_CAST(unsigned int, base)) * 16777619U;
+  for(i = 0; i < id_len; i++) {
+    hash ^= id[i];
+    hash *= 16777619U;
   }
-  
-  item = (char*)raptor_avltree_search(base->tree, id);
 
-  /* if already there, error */
-  if(item) {
+  mask = set->size - 1;
+  for(i = hash & mask; set->entries[i].id; i = (i + 1) & mask) {
+    entry = &set->entries[i];
+    if(entry->hash == hash && entry->base == RAPTOR_GOOD_CAST(unsigned int, base) &&
+       entry->id_len == id_len && !memcmp(entry->id, id, id_len)) {
+      /* if already there, error */
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-    set->misses++;
+      set->misses++;
 #endif
-    return 1;
+      return 1;
+    }
   }
   
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   set->hits++;
 #endif
-  
-  item = RAPTOR_MALLOC(char*, id_len + 1);
-  if(!item)
-    return 1;
 
-  memcpy(item, id, id_len + 1);
+  entry = &set->entries[i];
+  entry->id = raptor_id_set_pool_copy(set, id, id_len);
+  if(!entry->id)
+    return -1;
+  entry->id_len = id_len;
+  entry->base = RAPTOR_GOOD_CAST(unsigned int, base);
+  entry->hash = hash;
+  set->count++;
 
-  return raptor_avltree_add(base->tree, item);
+  return 0;
 }
 
 
@@ -264,6 +473,7 @@ main(int argc, char *argv[])
   const char *items[8] = { "ron", "amy", "jen", "bij", "jib", "daj", "jim", NULL };
   raptor_id_set *set;
   raptor_uri *base_uri;
+  raptor_uri *base_uri2;
   int i = 0;
   
   world = raptor_new_world();
@@ -314,6 +524,82 @@ if(rc) {
     }
   }
 
+  /* the same IDs are new for a different base URI */
+  base_uri2 = raptor_new_uri(world, (const unsigned char*)"http://example.org/base2#");
+  for(i = 0; items[i]; i++) {
+    size_t len = strlen(items[i]);
+    int rc;
+
+    rc = raptor_id_set_add(set, base_uri2, (const unsigned char*)items[i], len);
+    if(rc) {
+      fprintf(stderr, "%s: Adding set item %d '%s' for second base failed, returning error %d\n",
+              program, i, items[i], rc);
+      exit(1);
+    }
+  }
+
+  /* enough IDs alternating between bases to grow the table */
+  for(i = 0; i < 2000; i++) {
+    char id[20];
+    size_t len;
+    int rc;
+
+    len = RAPTOR_GOOD_CAST(size_t, sprintf(id, "id%d", i));
+    rc = raptor_id_set_add(set, (i & 1) ? base_uri2 : base_uri,
+                           (const unsigned char*)id, len);
+    if(rc) {
+      fprintf(stderr, "%s: Adding set item '%s' failed, returning error %d\n",
+              program, id, rc);
+      exit(1);
+    }
+  }
+
+  for(i = 0; i < 2000; i++) {
+    char id[20];
+    size_t len;
+    int rc;
+
+    len = RAPTOR_GOOD_CAST(size_t, sprintf(id, "id%d", i));
+    rc = raptor_id_set_add(set, (i & 1) ? base_uri2 : base_uri,
+                           (const unsigned char*)id, len);
+    if(rc != 1) {
+      fprintf(stderr, "%s: Adding duplicate set item '%s' returned %d, expected 1\n",
+              program, id, rc);
+      exit(1);
+    }
+  }
+
+  /* enough base URIs to grow the base table, each added twice */
+  for(i = 0; i < 100; i++) {
+    char uri_string[40];
+    raptor_uri *uri;
+    int rc;
+    int j;
+
+    sprintf(uri_string, "http://example.org/other%d#", i);
+    uri = raptor_new_uri(world, (const unsigned char*)uri_string);
+    if(!uri)
+      exit(1);
+
+    for(j = 0; j < 2; j++) {
+      rc = raptor_id_set_add(set, uri, (const unsigned char*)"ron", 3);
+      if(rc != j) {
+        fprintf(stderr, "%s: Adding set item 'ron' for base %s returned %d, expected %d\n",
+                program, uri_string, rc, j);
+        exit(1);
+      }
+      /* go back to the first base so the next lookup is not the last one */
+      rc = raptor_id_set_add(set, base_uri, (const unsigned char*)"ron", 3);
+      if(rc != 1) {
+        fprintf(stderr, "%s: Adding duplicate set item 'ron' returned %d, expected 1\n",
+                program, rc);
+        exit(1);
+      }
+    }
+
+    raptor_free_uri(uri);
+  }
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
   raptor_id_set_stats_print(set, stderr);
 #endif
@@ -324,6 +610,7 @@ if(rc) {
   raptor_free_id_set(set);
 
   raptor_free_uri(base_uri);
+  raptor_free_uri(base_uri2);
   
   raptor_free_world(world);
   
@@ -307,21 +307,67 @@ raptor_new_term_from_counted_blank(raptor_world* world,
 {
   raptor_term *t;
   unsigned char* new_id;
+  int id = 0;
 
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
 
   raptor_world_open(world);
 
-  if (blank) {
-    new_id = RAPTOR_MALLOC(unsigned char*, length + 1);
-    if(!new_id)
-      return NULL;
+  if(!blank) {
+    if(world->generate_bnodeid_handler)
+      return raptor_new_term_from_generated_blank(world, NULL);
+
+    length = raptor_world_next_default_bnodeid(world, &id);
+  }
+
+  /* the ID is stored after the term in the same allocation */
+  t = RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t) + length + 1);
+  if(!t)
+    return NULL;
+
+  new_id = (unsigned char*)(t + 1);
+  if(blank) {
     memcpy(new_id, blank, length);
     new_id[length] = '\0';
-  } else {
-    new_id = raptor_world_generate_bnodeid(world);
-    length = strlen((const char*)new_id);
-  }
+  } else
+    raptor_world_format_default_bnodeid(world, id, new_id, length);
+
+  t->usage = 1;
+  t->world = world;
+  t->type = RAPTOR_TERM_TYPE_BLANK;
+  t->value.blank.string = new_id;
+  t->value.blank.string_len = RAPTOR_BAD_CAST(int, length);
+
+  return t;
+}
+
+
+/*
+ * raptor_new_term_from_generated_blank:
+ * @world: raptor world
+ * @user_bnodeid: user blank node ID (or NULL) - ownership is taken
+ *
+ * INTERNAL - Constructor - create a blank node term with a generated ID
+ *
+ * The ID is made by raptor_world_internal_generate_id() from
+ * @user_bnodeid and used by the term without copying it.  New IDs
+ * from the default generator are formatted straight into the term.
+ *
+ * Return value: new term or NULL on failure
+ */
+raptor_term*
+raptor_new_term_from_generated_blank(raptor_world* world,
+                                     unsigned char* user_bnodeid)
+{
+  raptor_term *t;
+  unsigned char* new_id;
+
+  if(!user_bnodeid && !world->generate_bnodeid_handler)
+    return raptor_new_term_from_counted_blank(world, NULL, 0);
+
+  new_id = raptor_world_internal_generate_id(world, user_bnodeid);
+  if(!new_id)
+    return NULL;
 
   t = RAPTOR_CALLOC(raptor_term*, 1, sizeof(*t));
   if(!t) {
@@ -333,12 +379,46 @@ raptor_new_term_from_counted_blank(raptor_world* world,
   t->world = world;
   t->type = RAPTOR_TERM_TYPE_BLANK;
   t->value.blank.string = new_id;
-  t->value.blank.string_len = RAPTOR_BAD_CAST(int, length);
+  t->value.blank.string_len = RAPTOR_BAD_CAST(int, strlen((const char*)new_id));
 
   return t;
 }
 
 
+/*
+ * raptor_new_term_from_counted_generated_blank:
+ * @world: raptor world
+ * @user_bnodeid: user blank node ID
+ * @length: length of @user_bnodeid
+ *
+ * INTERNAL - Constructor - create a blank node term with a generated ID from a counted user ID
+ *
+ * As raptor_new_term_from_generated_blank() but takes a copy of
+ * @user_bnodeid, which need not be NUL terminated.  Without an ID
+ * generator handler the ID is copied straight into the term.
+ *
+ * Return value: new term or NULL on failure
+ */
+raptor_term*
+raptor_new_term_from_counted_generated_blank(raptor_world* world,
+                                             const unsigned char* user_bnodeid,
+                                             size_t length)
+{
+  unsigned char* id;
+
+  if(!world->generate_bnodeid_handler)
+    return raptor_new_term_from_counted_blank(world, user_bnodeid, length);
+
+  id = RAPTOR_MALLOC(unsigned char*, length + 1);
+  if(!id)
+    return NULL;
+  memcpy(id, user_bnodeid, length);
+  id[length] = '\0';
+
+  return raptor_new_term_from_generated_blank(world, id);
+}
+
+
 /**
  * raptor_new_term_from_blank:
  * @world: raptor world
@@ -370,12 +450,334 @@ raptor_new_term_from_blank(raptor_world* world, const unsigned char* blank)
 }
 
 
+/*
+ * Term arena
+ *
+ * Literal terms of one statement or statement batch are allocated
+ * from blocks that are reused once the statements have been handled.
+ * Their strings are either copied into the arena or borrowed from the
+ * parser's input buffer.  Arena terms have a negative usage count:
+ * raptor_free_term() ignores them and raptor_term_copy() copies them
+ * to the heap.
+ */
+
+/* Minimum size of an arena block */
+#define RAPTOR_TERM_ARENA_BLOCK_SIZE 65536
+
+/* usage count of a term allocated in an arena */
+#define RAPTOR_TERM_ARENA_USAGE -1
+
+typedef struct raptor_term_arena_block_s raptor_term_arena_block;
+
+struct raptor_term_arena_block_s {
+  raptor_term_arena_block* next;
+  size_t size;
+  /* followed by size bytes of storage */
+};
+
+struct raptor_term_arena_s {
+  raptor_world* world;
+
+  /* all blocks and the block being allocated from */
+  raptor_term_arena_block* blocks;
+  raptor_term_arena_block* current;
+  /* bytes used in current block */
+  size_t used;
+
+  /* datatype URI references held by arena terms */
+  raptor_uri** uris;
+  int uris_count;
+  int uris_size;
+};
+
+
+/* keep allocations aligned for raptor_term */
+#define RAPTOR_TERM_ARENA_ALIGN(n) (((n) + sizeof(void*) - 1) & ~(sizeof(void*) - 1))
+
+#define RAPTOR_TERM_ARENA_BLOCK_DATA(block) \
+  ((unsigned char*)(block) + RAPTOR_TERM_ARENA_ALIGN(sizeof(raptor_term_arena_block)))
+
+
+/*
+ * raptor_new_term_arena:
+ * @world: raptor world
+ *
+ * INTERNAL - Constructor - create an empty term arena
+ *
+ * Return value: new arena or NULL on failure
+ */
+raptor_term_arena*
+raptor_new_term_arena(raptor_world* world)
+{
+  raptor_term_arena* arena;
+
+  arena = RAPTOR_CALLOC(raptor_term_arena*, 1, sizeof(*arena));
+  if(!arena)
+    return NULL;
+
+  arena->world = world;
+
+  return arena;
+}
+
+
+/*
+ * raptor_term_arena_reset:
+ * @arena: term arena
+ *
+ * INTERNAL - Release all terms in the arena, keeping its blocks for reuse
+ */
+void
+raptor_term_arena_reset(raptor_term_arena* arena)
+{
+  int i;
+
+  for(i = 0; i < arena->uris_count; i++)
+    raptor_free_uri(arena->uris[i]);
+  arena->uris_count = 0;
+
+  arena->current = arena->blocks;
+  arena->used = 0;
+}
+
+
+/*
+ * raptor_free_term_arena:
+ * @arena: term arena
+ *
+ * INTERNAL - Destructor - destroy a term arena and all terms in it
+ */
+void
+raptor_free_term_arena(raptor_term_arena* arena)
+{
+  raptor_term_arena_block* block;
+
+  if(!arena)
+    return;
+
+  raptor_term_arena_reset(arena);
+
+  for(block = arena->blocks; block; ) {
+    raptor_term_arena_block* next = block->next;
+    RAPTOR_FREE(raptor_term_arena_block*, block);
+    block = next;
+  }
+
+  if(arena->uris)
+    RAPTOR_FREE(raptor_uri**, arena->uris);
+
+  RAPTOR_FREE(raptor_term_arena*, arena);
+}
+
+
+/*
+ * raptor_term_arena_alloc:
+ * @arena: term arena
+ * @size: bytes wanted
+ *
+ * INTERNAL - Allocate from the arena, moving to the next block or
+ * adding one when the current block is full.
+ *
+ * Return value: pointer to storage or NULL on failure
+ */
+static void*
+raptor_term_arena_alloc(raptor_term_arena* arena, size_t size)
+{
+  raptor_term_arena_block* block = arena->current;
+
+  size = RAPTOR_TERM_ARENA_ALIGN(size);
+
+  while(!block || arena->used + size > block->size) {
+    if(block && block->next) {
+      /* a block kept from before the last reset */
+      block = block->next;
+    } else {
+      raptor_term_arena_block* new_block;
+      size_t block_size = RAPTOR_TERM_ARENA_BLOCK_SIZE;
+
+      if(size > block_size)
+        block_size = size;
+
+      new_block = (raptor_term_arena_block*)RAPTOR_MALLOC(raptor_term_arena_block*, RAPTOR_TERM_ARENA_ALIGN(sizeof(raptor_term_arena_block)) + block_size);
+      if(!new_block)
+        return NULL;
+      new_block->size = block_size;
+
+      /* insert after the current block so that kept blocks stay in order */
+      if(block) {
+        new_block->next = block->next;
+        block->next = new_block;
+      } else {
+        new_block->next = arena->blocks;
+        arena->blocks = new_block;
+      }
+      block = new_block;
+    }
+
+    arena->current = block;
+    arena->used = 0;
+  }
+
+  arena->used += size;
+  return RAPTOR_TERM_ARENA_BLOCK_DATA(block) + arena->used - size;
+}
+
+
+/*
+ * raptor_new_term_from_counted_literal_in_arena:
+ * @arena: term arena
+ * @literal: UTF-8 encoded literal string (or NULL for empty literal)
+ * @literal_len: length of literal
+ * @datatype: literal datatype URI (or NULL)
+ * @language: literal language (or NULL for no language)
+ * @language_len: literal language length
+ * @borrow: non-0 to point at @literal and @language instead of copying
+ *
+ * INTERNAL - Constructor - create a literal term in an arena
+ *
+ * As raptor_new_term_from_counted_literal() but the term, literal and
+ * language share one arena allocation.  The term is valid until the
+ * arena is reset.
+ *
+ * If @borrow is set, @literal and @language must be NUL terminated
+ * and stay valid and unchanged for as long as the term.
+ *
+ * Return value: new term or NULL on failure
+ */
+raptor_term*
+raptor_new_term_from_counted_literal_in_arena(raptor_term_arena* arena,
+                                              const unsigned char* literal,
+                                              size_t literal_len,
+                                              raptor_uri* datatype,
+                                              const unsigned char* language,
+                                              unsigned char language_len,
+                                              int borrow)
+{
+  raptor_term *t;
+  unsigned char* new_literal;
+  unsigned char* new_language = NULL;
+  size_t term_size = RAPTOR_TERM_ARENA_ALIGN(sizeof(*t));
+  size_t strings_size = 0;
+
+  if(language && !*language)
+    language = NULL;
+
+  if(language && datatype)
+    return NULL;
+
+  if(!literal || !*literal)
+    literal_len = 0;
+
+  if(!language)
+    language_len = 0;
+
+  if(datatype) {
+    if(arena->uris_count == arena->uris_size) {
+      int new_size = arena->uris_size ? arena->uris_size * 2 : 16;
+      raptor_uri** new_uris;
+
+      new_uris = RAPTOR_REALLOC(raptor_uri**, arena->uris,
+                                new_size * sizeof(raptor_uri*));
+      if(!new_uris)
+        return NULL;
+      arena->uris = new_uris;
+      arena->uris_size = new_size;
+    }
+  }
+
+  /* only borrow strings that end at their given lengths */
+  if(borrow && ((literal_len && literal[literal_len]) ||
+                (language && language[language_len])))
+    borrow = 0;
+
+  if(!borrow)
+    strings_size = literal_len + 1 + (language ? language_len + 1 : 0);
+
+  t = (raptor_term*)raptor_term_arena_alloc(arena, term_size + strings_size);
+  if(!t)
+    return NULL;
+
+  if(borrow) {
+    new_literal = (unsigned char*)(literal_len ? literal : (const unsigned char*)"");
+    new_language = (unsigned char*)language;
+  } else {
+    new_literal = (unsigned char*)t + term_size;
+    if(literal_len)
+      memcpy(new_literal, literal, literal_len);
+    new_literal[literal_len] = '\0';
+
+    if(language) {
+      new_language = new_literal + literal_len + 1;
+      memcpy(new_language, language, language_len);
+      new_language[language_len] = '\0';
+    }
+  }
+
+  if(datatype) {
+    datatype = raptor_uri_copy(datatype);
+    arena->uris[arena->uris_count++] = datatype;
+  }
+
+  t->usage = RAPTOR_TERM_ARENA_USAGE;
+  t->world = arena->world;
+  t->type = RAPTOR_TERM_TYPE_LITERAL;
+  t->value.literal.string = new_literal;
+  t->value.literal.string_len = RAPTOR_LANG_LEN_FROM_INT(literal_len);
+  t->value.literal.language = new_language;
+  t->value.literal.language_len = language_len;
+  t->value.literal.datatype = datatype;
+
+  return t;
+}
+
+
+/*
+ * raptor_term_copy_from_arena:
+ * @term: term in an arena
+ *
+ * INTERNAL - Copy an arena term to a new heap term
+ *
+ * Return value: new term or NULL on failure
+ */
+static raptor_term*
+raptor_term_copy_from_arena(raptor_term* term)
+{
+  switch(term->type) {
+    case RAPTOR_TERM_TYPE_URI:
+      return raptor_new_term_from_uri(term->world, term->value.uri);
+
+    case RAPTOR_TERM_TYPE_BLANK:
+      return raptor_new_term_from_counted_blank(term->world,
+                                                term->value.blank.string,
+                                                RAPTOR_GOOD_CAST(size_t, term->value.blank.string_len));
+
+    case RAPTOR_TERM_TYPE_LITERAL:
+      return raptor_new_term_from_counted_literal(term->world,
+                                                  term->value.literal.string,
+                                                  RAPTOR_LANG_LEN_TO_SIZE_T(term->value.literal.string_len),
+                                                  term->value.literal.datatype,
+                                                  term->value.literal.language,
+                                                  term->value.literal.language_len);
+
+    case RAPTOR_TERM_TYPE_UNKNOWN:
+    default:
+      return NULL;
+  }
+}
+
+
 /**
  * raptor_term_copy:
  * @term: raptor term
  *
  * Copy constructor - get a copy of a statement term
  *
+ * A heap term gets another reference and is returned as-is.  A term
+ * allocated in a parser's arena (see #RAPTOR_OPTION_PARSE_ARENA), or
+ * one whose string is borrowed from the input buffer (see
+ * #RAPTOR_OPTION_PARSE_BORROW_TERMS), is copied to a new heap term
+ * that outlives the parser's buffers.
+ *
  * Return value: new term object or NULL on failure
  */
 raptor_term*
@@ -384,7 +786,10 @@ raptor_term_copy(raptor_term* term)
   if(!term)
     return NULL;
 
-  term->usage++;
+  if(term->usage < 0)
+    return raptor_term_copy_from_arena(term);
+
+  RAPTOR_USAGE_INCR(term->world, term->usage);
   return term;
 }
 
@@ -402,7 +807,11 @@ raptor_free_term(raptor_term *term)
   if(!term)
     return;
   
-  if(--term->usage)
+  /* arena terms are released when their arena is reset */
+  if(term->usage < 0)
+    return;
+
+  if(RAPTOR_USAGE_DECR(term->world, term->usage))
     return;
   
   switch(term->type) {
@@ -414,10 +823,11 @@ raptor_free_term(raptor_term *term)
       break;
 
     case RAPTOR_TERM_TYPE_BLANK:
-      if(term->value.blank.string) {
+      /* the ID may be stored after the term in the same allocation */
+      if(term->value.blank.string &&
+         term->value.blank.string != (unsigned char*)(term + 1))
         RAPTOR_FREE(char*, term->value.blank.string);
-        term->value.blank.string = NULL;
-      }
+      term->value.blank.string = NULL;
       break;
       
     case RAPTOR_TERM_TYPE_LITERAL:
@@ -684,6 +1094,204 @@ raptor_term_compare(const raptor_term *t1,  const raptor_term *t2)
 
   return d;
 }
+
+/*
+ * Recent term cache
+ *
+ * Parsers see the same subjects and predicates many times in a row;
+ * a small direct-mapped cache keyed by the term's bytes lets them hand
+ * out counted references to one term instead of building a new URI
+ * term or blank node term for every statement.
+ */
+
+/*
+ * Cheap slot hash: the length and up to the last 8 bytes, which is
+ * where URIs sharing a namespace and blank node IDs differ.  A
+ * collision only costs a cache miss.
+ */
+static unsigned int
+raptor_term_cache_hash(const unsigned char* string, size_t length)
+{
+  unsigned int hash = (unsigned int)length;
+  size_t i = (length > 8) ? length - 8 : 0;
+
+  for(; i < length; i++)
+    hash = (hash * 31) + string[i];
+
+  return hash ^ (hash >> 7);
+}
+
+
+/*
+ * raptor_term_cache_lookup:
+ * @cache: term cache
+ * @type: term type
+ * @string: URI or blank node ID string
+ * @length: length of @string
+ * @slot_p: pointer to store slot for the key
+ *
+ * INTERNAL - Find a cached term of @type for @string
+ *
+ * Return value: new reference to the cached term or NULL if not present
+ */
+static raptor_term*
+raptor_term_cache_lookup(raptor_term_cache* cache, raptor_term_type type,
+                         const unsigned char* string, size_t length,
+                         raptor_term*** slot_p)
+{
+  unsigned int hash = raptor_term_cache_hash(string, length) + (unsigned int)type;
+  raptor_term** slot;
+  raptor_term* term;
+  const unsigned char* term_string;
+  size_t term_length;
+
+  slot = &cache->terms[hash & (RAPTOR_TERM_CACHE_SIZE - 1)];
+  *slot_p = slot;
+
+  term = *slot;
+  if(!term || term->type != type)
+    return NULL;
+
+  if(type == RAPTOR_TERM_TYPE_URI)
+    term_string = raptor_uri_as_counted_string(term->value.uri, &term_length);
+  else {
+    term_string = term->value.blank.string;
+    term_length = RAPTOR_GOOD_CAST(size_t, term->value.blank.string_len);
+  }
+
+  if(term_length != length || memcmp(term_string, string, length))
+    return NULL;
+
+  return raptor_term_copy(term);
+}
+
+
+/*
+ * raptor_term_cache_store:
+ * @slot: cache slot
+ * @term: term to store or NULL
+ *
+ * INTERNAL - Replace the term held in a cache slot with @term
+ *
+ * Return value: @term
+ */
+static raptor_term*
+raptor_term_cache_store(raptor_term** slot, raptor_term* term)
+{
+  if(term) {
+    if(*slot)
+      raptor_free_term(*slot);
+    *slot = raptor_term_copy(term);
+  }
+
+  return term;
+}
+
+
+/*
+ * raptor_term_cache_get_uri:
+ * @cache: term cache
+ * @world: raptor world
+ * @uri_string: URI string
+ * @length: length of @uri_string
+ *
+ * INTERNAL - Get a URI term for a URI string using the cache
+ *
+ * Return value: new term reference or NULL on failure
+ */
+raptor_term*
+raptor_term_cache_get_uri(raptor_term_cache* cache, raptor_world* world,
+                          const unsigned char* uri_string, size_t length)
+{
+  raptor_term** slot;
+  raptor_term* term;
+
+  term = raptor_term_cache_lookup(cache, RAPTOR_TERM_TYPE_URI,
+                                  uri_string, length, &slot);
+  if(term)
+    return term;
+
+  term = raptor_new_term_from_counted_uri_string(world, uri_string, length);
+  return raptor_term_cache_store(slot, term);
+}
+
+
+/*
+ * raptor_term_cache_get_term_from_uri:
+ * @cache: term cache
+ * @world: raptor world
+ * @uri: URI
+ *
+ * INTERNAL - Get a URI term for a URI object using the cache
+ *
+ * Return value: new term reference or NULL on failure
+ */
+raptor_term*
+raptor_term_cache_get_term_from_uri(raptor_term_cache* cache,
+                                    raptor_world* world, raptor_uri* uri)
+{
+  raptor_term** slot;
+  raptor_term* term;
+  const unsigned char* uri_string;
+  size_t length;
+
+  uri_string = raptor_uri_as_counted_string(uri, &length);
+  term = raptor_term_cache_lookup(cache, RAPTOR_TERM_TYPE_URI,
+                                  uri_string, length, &slot);
+  if(term)
+    return term;
+
+  term = raptor_new_term_from_uri(world, uri);
+  return raptor_term_cache_store(slot, term);
+}
+
+
+/*
+ * raptor_term_cache_get_blank:
+ * @cache: term cache
+ * @world: raptor world
+ * @blank: blank node ID
+ * @length: length of @blank
+ *
+ * INTERNAL - Get a blank node term for a blank node ID using the cache
+ *
+ * Return value: new term reference or NULL on failure
+ */
+raptor_term*
+raptor_term_cache_get_blank(raptor_term_cache* cache, raptor_world* world,
+                            const unsigned char* blank, size_t length)
+{
+  raptor_term** slot;
+  raptor_term* term;
+
+  term = raptor_term_cache_lookup(cache, RAPTOR_TERM_TYPE_BLANK,
+                                  blank, length, &slot);
+  if(term)
+    return term;
+
+  term = raptor_new_term_from_counted_blank(world, blank, length);
+  return raptor_term_cache_store(slot, term);
+}
+
+
+/*
+ * raptor_term_cache_clear:
+ * @cache: term cache
+ *
+ * INTERNAL - Release all terms held by the cache
+ */
+void
+raptor_term_cache_clear(raptor_term_cache* cache)
+{
+  int i;
+
+  for(i = 0; i < RAPTOR_TERM_CACHE_SIZE; i++) {
+    if(cache->terms[i]) {
+      raptor_free_term(cache->terms[i]);
+      cache->terms[i] = NULL;
+    }
+  }
+}
 #endif
 
 
@@ -718,6 +1326,10 @@ main(int argc, char *argv[])
   raptor_term* term3 = NULL; /* blank node 1 */
   raptor_term* term4 = NULL; /* URI string 2 */
   raptor_term* term5 = NULL; /* URI string 1 again */
+  raptor_term* term6 = NULL; /* cached URI string 1 */
+  raptor_term* term7 = NULL; /* cached URI string 1 again */
+  raptor_term* term8 = NULL; /* cached blank node 1 */
+  raptor_term_cache cache;
   raptor_uri* uri1;
   unsigned char* uri_str;
   size_t uri_len;
@@ -727,6 +1339,8 @@ main(int argc, char *argv[])
   if(!world || raptor_world_open(world))
     exit(1);
 
+  memset(&cache, 0, sizeof(cache));
+
 
   /* check a term for NULL URI fails */
   term1 = raptor_new_term_from_uri(world, NULL);
@@ -944,6 +1558,34 @@ main(int argc, char *argv[])
     rc = 1;
     goto tidy;
   }
+
+
+  /* check the term cache shares terms for the same string */
+  term6 = raptor_term_cache_get_uri(&cache, world,
+                                    uri_string1, uri_string1_len);
+  term7 = raptor_term_cache_get_uri(&cache, world,
+                                    uri_string1, uri_string1_len);
+  if(!term6 || term6 != term7) {
+    fprintf(stderr, "%s: raptor_term_cache_get_uri(URI %s) twice returned different terms\n",
+            program, uri_string1);
+    rc = 1;
+    goto tidy;
+  }
+
+  if(!raptor_term_equals(term1, term6)) {
+    fprintf(stderr, "%s: raptor_term_cache_get_uri(URI %s) returned term not-equal to URI %s\n",
+            program, uri_string1, uri_string1);
+    rc = 1;
+    goto tidy;
+  }
+
+  term8 = raptor_term_cache_get_blank(&cache, world, bnodeid1, bnodeid1_len);
+  if(!term8 || !raptor_term_equals(term3, term8) || term8 == term6) {
+    fprintf(stderr, "%s: raptor_term_cache_get_blank(bnode %s) returned wrong term\n",
+            program, bnodeid1);
+    rc = 1;
+    goto tidy;
+  }
   
 
   tidy:
@@ -957,6 +1599,13 @@ main(int argc, char *argv[])
     raptor_free_term(term4);
   if(term5)
     raptor_free_term(term5);
+  if(term6)
+    raptor_free_term(term6);
+  if(term7)
+    raptor_free_term(term7);
+  if(term8)
+    raptor_free_term(term8);
+  raptor_term_cache_clear(&cache);
   
   raptor_free_world(world);
 
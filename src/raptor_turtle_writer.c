@@ -372,6 +372,56 @@ raptor_turtle_writer_qname(raptor_turtle_writer* turtle_writer,
 }
 
 
+/*
+ * Bytes raptor_string_python_write() copies unescaped, unless they are
+ * the delimiter: bit 0 for N-Triples, Turtle and JSON, bit 1 for
+ * Turtle long strings.  NUL, backslash and 0x80-0xFF are always 0.
+ */
+static const unsigned char raptor_string_python_plain[256] = {
+  0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2
+};
+
+static const char raptor_string_python_hex[16] = {
+  '0', '1', '2', '3', '4', '5', '6', '7',
+  '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+};
+
+
+/*
+ * raptor_string_python_write_unichar:
+ * @unichar: Unicode codepoint
+ * @iostr: #raptor_iostream to write to
+ *
+ * INTERNAL - Write a \uXXXX escape or \UXXXXXXXX for codepoints above U+FFFF
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_string_python_write_unichar(raptor_unichar unichar,
+                                   raptor_iostream *iostr)
+{
+  char buf[10];
+  int width = (unichar < 0x10000) ? 4 : 8;
+  int i;
+
+  buf[0] = '\\';
+  buf[1] = (width == 4) ? 'u' : 'U';
+  for(i = width + 1; i > 1; i--) {
+    buf[i] = raptor_string_python_hex[unichar & 0xf];
+    unichar >>= 4;
+  }
+
+  return raptor_iostream_put_counted_string(buf, width + 2, iostr);
+}
+
+
 /**
  * raptor_string_python_write:
  * @string: UTF-8 string to write
@@ -392,88 +442,101 @@ raptor_string_python_write(const unsigned char *string,
                            int flags,
                            raptor_iostream *iostr)
 {
+  const unsigned char d = RAPTOR_GOOD_CAST(unsigned char, delim);
+  unsigned char plain_mask;
   unsigned char c;
   int unichar_len;
   raptor_unichar unichar;
+  size_t run;
+  size_t valid_len;
 
   if(flags < 0 || flags > 3)
     return 1;
-  
-  for(; (c=*string); string++, len--) {
-    if((delim && c == delim && (delim == '\'' || delim == '"')) ||
-       c == '\\') {
-      raptor_iostream_write_byte('\\', iostr);
-      raptor_iostream_write_byte(c, iostr);
+
+  plain_mask = (flags == 2) ? 2 : 1;
+
+  while(1) {
+    const unsigned char *start = string;
+
+    /* Write the run of bytes that need no escaping in one go */
+    for(c = *string; (raptor_string_python_plain[c] & plain_mask) && c != d; )
+      c = *++string;
+
+    if(string != start) {
+      run = RAPTOR_GOOD_CAST(size_t, string - start);
+      raptor_iostream_put_counted_string(start, run, iostr);
+      len -= run;
+    }
+
+    if(!c)
+      break;
+
+    if((d && c == d && (d == '\'' || d == '"')) || c == '\\') {
+      char buf[2];
+
+      buf[0] = '\\';
+      buf[1] = RAPTOR_GOOD_CAST(char, c);
+      raptor_iostream_put_counted_string(buf, 2, iostr);
+      string++; len--;
       continue;
     }
-    if(delim && c == delim) {
-      raptor_iostream_counted_string_write("\\u", 2, iostr);
-      raptor_iostream_hexadecimal_write(c, 4, iostr);
+    if(d && c == d) {
+      raptor_string_python_write_unichar(c, iostr);
+      string++; len--;
       continue;
     }
-    
-    if(flags != 2) {
-      /* N-Triples, Turtle or JSON */
-
-      /* Note: NTriples is ASCII */
-      if(c == 0x09) {
-        raptor_iostream_counted_string_write("\\t", 2, iostr);
-        continue;
-      } else if((flags == 3) && c == 0x08) {
+
+    if(c < 0x80) {
+      /* N-Triples, Turtle or JSON control character; Turtle long
+       * strings have none left to escape */
+      if(c == 0x09)
+        raptor_iostream_put_counted_string("\\t", 2, iostr);
+      else if((flags == 3) && c == 0x08)
         /* JSON has \b for backspace */
-        raptor_iostream_counted_string_write("\\b", 2, iostr);
-        continue;
-      } else if(c == 0x0a) {
-        raptor_iostream_counted_string_write("\\n", 2, iostr);
-        continue;
-      } else if((flags == 3) && c == 0x0b) {
+        raptor_iostream_put_counted_string("\\b", 2, iostr);
+      else if(c == 0x0a)
+        raptor_iostream_put_counted_string("\\n", 2, iostr);
+      else if((flags == 3) && c == 0x0b)
         /* JSON has \f for formfeed */
-        raptor_iostream_counted_string_write("\\f", 2, iostr);
-        continue;
-      } else if(c == 0x0d) {
-        raptor_iostream_counted_string_write("\\r", 2, iostr);
-        continue;
-      } else if(c < 0x20|| c == 0x7f) {
-        raptor_iostream_counted_string_write("\\u", 2, iostr);
-        raptor_iostream_hexadecimal_write(c, 4, iostr);
-        continue;
-      } else if(c < 0x80) {
-        raptor_iostream_write_byte(c, iostr);
-        continue;
-      }
-    } else if(c < 0x80) {
-      /* Turtle long string has no escapes except delim */
-      raptor_iostream_write_byte(c, iostr);
+        raptor_iostream_put_counted_string("\\f", 2, iostr);
+      else if(c == 0x0d)
+        raptor_iostream_put_counted_string("\\r", 2, iostr);
+      else
+        raptor_string_python_write_unichar(c, iostr);
+      string++; len--;
       continue;
-    } 
-    
-    /* It is unicode */
+    }
     
-    unichar_len = raptor_unicode_utf8_string_get_char(string, len, NULL);
-    if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > len)
-      /* UTF-8 encoding had an error or ended in the middle of a string */
-      return 1;
+    /* It is unicode: validate the whole run of non-ASCII bytes at once */
+    for(run = 1; run < len && string[run] > 0x7f; run++)
+      ;
+    valid_len = raptor_unicode_utf8_valid_length(string, run);
 
     if(flags >= 1 && flags <= 3) {
       /* Turtle and JSON are UTF-8 - no need to escape */
-      raptor_iostream_counted_string_write(string, unichar_len, iostr);
+      raptor_iostream_put_counted_string(string, valid_len, iostr);
     } else {
-      unichar_len = raptor_unicode_utf8_string_get_char(string, len, &unichar);
-      if(unichar_len < 0)
-        return 1;
+      const unsigned char *p = string;
+      size_t l = valid_len;
 
-      if(unichar < 0x10000) {
-        raptor_iostream_counted_string_write("\\u", 2, iostr);
-        raptor_iostream_hexadecimal_write(RAPTOR_GOOD_CAST(unsigned int, unichar), 4, iostr);
-      } else {
-        raptor_iostream_counted_string_write("\\U", 2, iostr);
-        raptor_iostream_hexadecimal_write(RAPTOR_GOOD_CAST(unsigned int, unichar), 8, iostr);
+      /* N-Triples is ASCII - decode to write escapes */
+      while(l > 0) {
+        unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
+        if(unichar_len < 0)
+          return 1;
+
+        raptor_string_python_write_unichar(unichar, iostr);
+
+        p += unichar_len;
+        l -= unichar_len;
       }
     }
-    
-    unichar_len--; /* since loop does len-- */
-    string += unichar_len; len -= unichar_len;
 
+    if(valid_len != run)
+      /* UTF-8 encoding had an error or ended in the middle of a string */
+      return 1;
+    
+    string += run; len -= run;
   }
 
   return 0;
@@ -684,6 +747,7 @@ raptor_turtle_writer_set_option(raptor_turtle_writer *turtle_writer,
     case RAPTOR_OPTION_WRITER_AUTO_EMPTY:
     case RAPTOR_OPTION_WRITER_XML_VERSION:
     case RAPTOR_OPTION_WRITER_XML_DECLARATION:
+    case RAPTOR_OPTION_WRITER_XML_TRUST_UTF8:
       break;
         
     /* parser options */
@@ -701,6 +765,8 @@ raptor_turtle_writer_set_option(raptor_turtle_writer *turtle_writer,
     case RAPTOR_OPTION_HTML_LINK:
     case RAPTOR_OPTION_WWW_TIMEOUT:
     case RAPTOR_OPTION_STRICT:
+    case RAPTOR_OPTION_PARSE_ARENA:
+    case RAPTOR_OPTION_PARSE_BORROW_TERMS:
       
     /* Shared */
     case RAPTOR_OPTION_NO_NET:
@@ -726,6 +792,8 @@ raptor_turtle_writer_set_option(raptor_turtle_writer *turtle_writer,
     
     /* Turtle serializer option */
     case RAPTOR_OPTION_WRITE_BASE_URI:
+    case RAPTOR_OPTION_SERIALIZE_MEMORY_LIMIT:
+    case RAPTOR_OPTION_SERIALIZE_SORTED_INPUT:
 
     /* WWW option */
     case RAPTOR_OPTION_WWW_HTTP_CACHE_CONTROL:
@@ -809,6 +877,7 @@ raptor_turtle_writer_get_option(raptor_turtle_writer *turtle_writer,
     case RAPTOR_OPTION_WRITER_AUTO_EMPTY:
     case RAPTOR_OPTION_WRITER_XML_VERSION:
     case RAPTOR_OPTION_WRITER_XML_DECLARATION:
+    case RAPTOR_OPTION_WRITER_XML_TRUST_UTF8:
       
     /* parser options */
     case RAPTOR_OPTION_SCANNING:
@@ -825,6 +894,8 @@ raptor_turtle_writer_get_option(raptor_turtle_writer *turtle_writer,
     case RAPTOR_OPTION_HTML_LINK:
     case RAPTOR_OPTION_WWW_TIMEOUT:
     case RAPTOR_OPTION_STRICT:
+    case RAPTOR_OPTION_PARSE_ARENA:
+    case RAPTOR_OPTION_PARSE_BORROW_TERMS:
 
     /* Shared */
     case RAPTOR_OPTION_NO_NET:
@@ -850,6 +921,8 @@ raptor_turtle_writer_get_option(raptor_turtle_writer *turtle_writer,
     
     /* Turtle serializer option */
     case RAPTOR_OPTION_WRITE_BASE_URI:
+    case RAPTOR_OPTION_SERIALIZE_MEMORY_LIMIT:
+    case RAPTOR_OPTION_SERIALIZE_SORTED_INPUT:
 
     /* WWW option */
     case RAPTOR_OPTION_WWW_HTTP_CACHE_CONTROL:
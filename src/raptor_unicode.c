@@ -797,16 +797,7 @@ raptor_unicode_is_extender(long c)
 int
 raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length) 
 {
-  unsigned int i;
-  int plain = 1;
-  
-  for(i = 0; i < length; i++)
-    if(input[i] > 0x7f) {
-      plain = 0;
-      break;
-    }
-    
-  if(plain)
+  if(raptor_unicode_utf8_ascii_span(input, length) == length)
     return 1;
 
 #ifdef RAPTOR_NFC_CHECK  
@@ -817,33 +808,147 @@ raptor_unicode_check_utf8_nfc_string(const unsigned char *input, size_t length)
 }
 
 
+/* Word with the top bit of every byte set */
+#define RAPTOR_UTF8_WORD_HIGH_BITS ((~(size_t)0 / 0xff) * 0x80)
+
+/*
+ * raptor_unicode_utf8_ascii_span:
+ * @string: UTF-8 string
+ * @length: length of string
+ *
+ * INTERNAL - Count the leading US-ASCII bytes of a string
+ *
+ * Tests a machine word of bytes per step so that runs of ASCII need
+ * no per-character decoding.
+ *
+ * Return value: number of bytes before the first byte > 0x7F or @length
+ */
+size_t
+raptor_unicode_utf8_ascii_span(const unsigned char *string, size_t length)
+{
+  const unsigned char *p = string;
+  const unsigned char *end = string + length;
+
+  while(RAPTOR_GOOD_CAST(size_t, end - p) >= sizeof(size_t)) {
+    size_t word;
+
+    memcpy(&word, p, sizeof(word));
+    if(word & RAPTOR_UTF8_WORD_HIGH_BITS)
+      break;
+    p += sizeof(word);
+  }
+
+  while(p < end && !(*p & 0x80))
+    p++;
+
+  return RAPTOR_GOOD_CAST(size_t, p - string);
+}
+
+
+/*
+ * raptor_unicode_utf8_valid_length:
+ * @string: UTF-8 string
+ * @length: length of string
+ *
+ * INTERNAL - Find the length of the longest valid UTF-8 prefix of a string
+ *
+ * Runs of US-ASCII are skipped a word at a time and multi-byte
+ * sequences are checked for well-formedness (RFC 3629) without
+ * decoding them: continuation bytes, overlong forms, UTF-16
+ * surrogates, U+FFFE, U+FFFF and code points above U+10FFFF are
+ * rejected.
+ *
+ * Return value: number of bytes that are valid UTF-8; @length if all are
+ */
+size_t
+raptor_unicode_utf8_valid_length(const unsigned char *string, size_t length)
+{
+  const unsigned char *p = string;
+  const unsigned char *end = string + length;
+
+  while(p < end) {
+    unsigned char c;
+    unsigned char lo = 0x80;
+    unsigned char hi = 0xBF;
+    size_t size;
+
+    c = *p;
+    if(c < 0x80) {
+      p += raptor_unicode_utf8_ascii_span(p, RAPTOR_GOOD_CAST(size_t, end - p));
+      continue;
+    }
+
+    if(c < 0xC2)
+      /* continuation byte or overlong 2 byte form */
+      break;
+    else if(c < 0xE0)
+      size = 2;
+    else if(c < 0xF0)
+      size = 3;
+    else if(c < 0xF5)
+      size = 4;
+    else
+      /* beyond U+10FFFF */
+      break;
+
+    if(size > RAPTOR_GOOD_CAST(size_t, end - p))
+      break;
+
+    /* the second byte range excludes overlong forms, surrogates and
+     * code points beyond U+10FFFF */
+    switch(c) {
+      case 0xE0:
+        lo = 0xA0;
+        break;
+      case 0xED:
+        hi = 0x9F;
+        break;
+      case 0xF0:
+        lo = 0x90;
+        break;
+      case 0xF4:
+        hi = 0x8F;
+        break;
+      default:
+        break;
+    }
+    if(p[1] < lo || p[1] > hi)
+      break;
+
+    if(size > 2) {
+      if((p[2] & 0xC0) != 0x80)
+        break;
+      /* U+FFFE and U+FFFF */
+      if(c == 0xEF && p[1] == 0xBF && p[2] > 0xBD)
+        break;
+      if(size > 3 && (p[3] & 0xC0) != 0x80)
+        break;
+    }
+
+    p += size;
+  }
+
+  return RAPTOR_GOOD_CAST(size_t, p - string);
+}
+
+
 /**
  * raptor_unicode_check_utf8_string:
  * @string: UTF-8 string
  * @length: length of string
  *
  * Check a string is valid Unicode UTF-8.
+ *
+ * Malformed sequences such as bad continuation bytes, overlong forms
+ * and UTF-16 surrogates are rejected as well as U+FFFE, U+FFFF and
+ * code points above U+10FFFF.
  * 
  * Return value: Non 0 if the string is UTF-8
  **/
 int
 raptor_unicode_check_utf8_string(const unsigned char *string, size_t length)
 {
-  while(length > 0) {
-    raptor_unichar unichar = 0;
-
-    int unichar_len;
-    unichar_len = raptor_unicode_utf8_string_get_char(string, length, &unichar);
-    if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > length)
-      return 0;
-
-    if(unichar > raptor_unicode_max_codepoint)
-      return 0;
-  
-    string += unichar_len;
-    length -= unichar_len;
-  }
-  return 1;
+  return raptor_unicode_utf8_valid_length(string, length) == length;
 }
 
 
@@ -863,6 +968,16 @@ raptor_unicode_utf8_strlen(const unsigned char *string, size_t length)
   
   while(length > 0) {
     int unichar_len;
+    size_t ascii_len;
+
+    ascii_len = raptor_unicode_utf8_ascii_span(string, length);
+    if(ascii_len) {
+      string += ascii_len;
+      length -= ascii_len;
+      unicode_length += RAPTOR_GOOD_CAST(int, ascii_len);
+      continue;
+    }
+
     unichar_len = raptor_unicode_utf8_string_get_char(string, length, NULL);
     if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > length) {
       unicode_length = -1;
@@ -942,3 +1057,84 @@ raptor_unicode_utf8_substr(unsigned char* dest, size_t* dest_length_p,
 
   return dest_bytes;
 }
+
+
+
+#ifdef STANDALONE
+
+/* one more prototype */
+int main(int argc, char *argv[]);
+
+
+static int
+assert_check_utf8(const char *label, const char *s, size_t len, int expected)
+{
+  int result = raptor_unicode_check_utf8_string((const unsigned char*)s, len);
+
+  if(result != expected) {
+    fprintf(stderr, "FAIL raptor_unicode_check_utf8_string(%s) gave %d != %d\n",
+            label, result, expected);
+    return 1;
+  }
+  return 0;
+}
+
+
+static int
+assert_ascii_span(const char *s, size_t expected)
+{
+  size_t result = raptor_unicode_utf8_ascii_span((const unsigned char*)s,
+                                                 strlen(s));
+
+  if(result != expected) {
+    fprintf(stderr, "FAIL raptor_unicode_utf8_ascii_span(%s) gave %d != %d\n",
+            s, (int)result, (int)expected);
+    return 1;
+  }
+  return 0;
+}
+
+
+#define CHECK(label, s, expected) assert_check_utf8(label, s, sizeof(s) - 1, expected)
+
+int
+main(int argc, char *argv[]) 
+{
+  int failures = 0;
+
+  failures += assert_ascii_span("", 0);
+  failures += assert_ascii_span("abc", 3);
+  failures += assert_ascii_span("0123456789abcdefghij", 20);
+  failures += assert_ascii_span("0123456789abcdef\xc3\xa9", 16);
+  failures += assert_ascii_span("012\xc3\xa9" "456789abcdef", 3);
+
+  failures += CHECK("empty", "", 1);
+  failures += CHECK("ascii", "http://example.org/long/ascii/path", 1);
+  failures += CHECK("2 byte", "caf\xc3\xa9", 1);
+  failures += CHECK("3 byte", "\xe2\x82\xac 100", 1);
+  failures += CHECK("4 byte", "\xf0\x9f\x98\x80", 1);
+  failures += CHECK("U+10FFFF", "\xf4\x8f\xbf\xbf", 1);
+  failures += CHECK("U+FFFD", "\xef\xbf\xbd", 1);
+  failures += CHECK("mixed", "abcdefgh\xc3\xa9ijklmnop\xe2\x82\xacqrstuvwx", 1);
+
+  failures += CHECK("lone continuation", "ab\x80", 0);
+  failures += CHECK("bad continuation", "\xc3\x41", 0);
+  failures += CHECK("truncated", "abc\xe2\x82", 0);
+  failures += CHECK("overlong 2 byte", "\xc0\xaf", 0);
+  failures += CHECK("overlong 3 byte", "\xe0\x80\xaf", 0);
+  failures += CHECK("overlong 4 byte", "\xf0\x80\x80\xaf", 0);
+  failures += CHECK("surrogate", "\xed\xa0\x80", 0);
+  failures += CHECK("U+FFFE", "\xef\xbf\xbe", 0);
+  failures += CHECK("U+FFFF", "\xef\xbf\xbf", 0);
+  failures += CHECK("U+110000", "\xf4\x90\x80\x80", 0);
+  failures += CHECK("5 byte", "\xf8\x88\x80\x80\x80", 0);
+
+  if(raptor_unicode_utf8_strlen((const unsigned char*)"caf\xc3\xa9 au lait", 13) != 12) {
+    fprintf(stderr, "FAIL raptor_unicode_utf8_strlen\n");
+    failures++;
+  }
+
+  return failures;
+}
+
+#endif
@@ -81,9 +81,207 @@ struct raptor_uri_s {
   unsigned int length;
   /* usage count */
   int usage;
+  /* hash of string, for interning */
+  unsigned int hash;
+  /* parsed string when used as a base URI or NULL */
+  raptor_uri_detail *detail;
 };
 
 
+/* Initial size of URI interning hash table; must be a power of 2 */
+#define RAPTOR_URI_HASH_INITIAL_SIZE 1024
+
+/* Number of separately locked parts of the URI interning hash table
+ * for a world shared between threads; must be a power of 2 */
+#define RAPTOR_URI_HASH_THREAD_PARTS 16
+
+
+/*
+ * raptor_uri_hash_string:
+ * @string: URI string
+ * @length: length of string
+ *
+ * INTERNAL - Hash a URI string (32 bit FNV-1a)
+ *
+ * Return value: hash
+ */
+static unsigned int
+raptor_uri_hash_string(const unsigned char *string, size_t length)
+{
+  unsigned int hash = 2166136261U;
+
+  while(length--) {
+    hash ^= *string++;
+    hash *= 16777619U;
+  }
+
+  return hash;
+}
+
+
+/*
+ * raptor_uri_hash_get_part:
+ * @world: world
+ * @hash: hash of URI string
+ *
+ * INTERNAL - Get the part of the URI hash table holding URIs with @hash
+ *
+ * The top bits of the hash choose the part so that the low bits used
+ * to find a slot inside the part stay well distributed.
+ *
+ * Return value: table part
+ */
+static raptor_uri_hash_part*
+raptor_uri_hash_get_part(raptor_world* world, unsigned int hash)
+{
+  return &world->uris_hash[(hash >> 24) & (world->uris_hash_parts_count - 1)];
+}
+
+
+#ifdef RAPTOR_WORLD_THREADS
+#define RAPTOR_URI_HASH_LOCK(world, part) \
+  do { if((world)->thread_safe) pthread_mutex_lock(&(part)->lock); } while(0)
+#define RAPTOR_URI_HASH_UNLOCK(world, part) \
+  do { if((world)->thread_safe) pthread_mutex_unlock(&(part)->lock); } while(0)
+#else
+#define RAPTOR_URI_HASH_LOCK(world, part) do { } while(0)
+#define RAPTOR_URI_HASH_UNLOCK(world, part) do { } while(0)
+#endif
+
+
+/*
+ * raptor_uri_hash_find:
+ * @part: hash table part
+ * @string: URI string
+ * @length: length of string
+ * @hash: hash of string
+ *
+ * INTERNAL - Find an interned URI
+ *
+ * Return value: the URI or NULL if not found
+ */
+static raptor_uri*
+raptor_uri_hash_find(raptor_uri_hash_part* part, const unsigned char *string,
+                     unsigned int length, unsigned int hash)
+{
+  unsigned int mask = part->size - 1;
+  unsigned int i;
+  raptor_uri* uri;
+
+  for(i = hash & mask; (uri = part->uris[i]); i = (i + 1) & mask) {
+    if(uri->hash == hash && uri->length == length &&
+       !memcmp(uri->string, string, length))
+      return uri;
+  }
+
+  return NULL;
+}
+
+
+/*
+ * raptor_uri_hash_insert:
+ * @part: hash table part
+ * @uri: URI not in the table
+ *
+ * INTERNAL - Insert a URI into the table which must have a free slot
+ */
+static void
+raptor_uri_hash_insert(raptor_uri_hash_part* part, raptor_uri* uri)
+{
+  unsigned int mask = part->size - 1;
+  unsigned int i;
+
+  for(i = uri->hash & mask; part->uris[i]; i = (i + 1) & mask)
+    ;
+  part->uris[i] = uri;
+  part->count++;
+}
+
+
+/*
+ * raptor_uri_hash_add:
+ * @part: hash table part
+ * @uri: URI not in the table
+ *
+ * INTERNAL - Add a URI to the table, growing it to keep it at most half full
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_uri_hash_add(raptor_uri_hash_part* part, raptor_uri* uri)
+{
+  if((part->count + 1) * 2 > part->size) {
+    raptor_uri** old_uris = part->uris;
+    unsigned int old_size = part->size;
+    unsigned int i;
+
+    part->uris = RAPTOR_CALLOC(raptor_uri**, old_size * 2,
+                               sizeof(raptor_uri*));
+    if(!part->uris) {
+      part->uris = old_uris;
+      return 1;
+    }
+    part->size = old_size * 2;
+    part->count = 0;
+
+    for(i = 0; i < old_size; i++) {
+      if(old_uris[i])
+        raptor_uri_hash_insert(part, old_uris[i]);
+    }
+    RAPTOR_FREE(raptor_uri**, old_uris);
+  }
+
+  raptor_uri_hash_insert(part, uri);
+
+  return 0;
+}
+
+
+/*
+ * raptor_uri_hash_delete:
+ * @part: hash table part
+ * @uri: URI in the table
+ *
+ * INTERNAL - Remove a URI from the table
+ *
+ * Later entries in the probe sequence are shifted back so that no
+ * deleted markers are needed.
+ */
+static void
+raptor_uri_hash_delete(raptor_uri_hash_part* part, raptor_uri* uri)
+{
+  unsigned int mask = part->size - 1;
+  unsigned int i;
+  unsigned int j;
+
+  for(i = uri->hash & mask; part->uris[i] != uri; i = (i + 1) & mask) {
+    if(!part->uris[i])
+      return;
+  }
+
+  j = i;
+  while(1) {
+    unsigned int k;
+
+    part->uris[i] = NULL;
+
+    /* find the next entry that may move back into slot i */
+    do {
+      j = (j + 1) & mask;
+      if(!part->uris[j]) {
+        part->count--;
+        return;
+      }
+      k = part->uris[j]->hash & mask;
+      /* entry j stays if its home slot k is cyclically in (i, j] */
+    } while((i <= j) ? (i < k && k <= j) : (i < k || k <= j));
+
+    part->uris[i] = part->uris[j];
+    i = j;
+  }
+}
+
+
 /**
  * raptor_new_uri_from_counted_string:
  * @world: raptor_world object
@@ -104,6 +302,8 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 {
   raptor_uri* new_uri;
   unsigned char *new_string;
+  unsigned int hash = 0;
+  raptor_uri_hash_part* part = NULL;
   
   RAPTOR_CHECK_CONSTRUCTOR_WORLD(world);
 
@@ -117,24 +317,22 @@ raptor_new_uri_from_counted_string(raptor_world* world,
                 "URI string is not declared length");
 #endif
 
-  if(world->uris_tree) {
-    raptor_uri key; /* on stack - not allocated */
-
-    /* just to be safe */
-    memset(&key, 0, sizeof(key));
+  if(world->uris_hash) {
+    hash = raptor_uri_hash_string(uri_string, length);
+    part = raptor_uri_hash_get_part(world, hash);
 
-    key.string = (unsigned char*)uri_string;
-    key.length = (unsigned int)length;
+    RAPTOR_URI_HASH_LOCK(world, part);
 
-    /* if existing URI found in tree, return it */
-    new_uri = (raptor_uri*)raptor_avltree_search(world->uris_tree, &key);
+    /* if existing URI found in hash, return it */
+    new_uri = raptor_uri_hash_find(part, uri_string, (unsigned int)length,
+                                   hash);
     if(new_uri) {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
       RAPTOR_DEBUG3("Found existing URI %s with current usage %d\n",
                     uri_string, new_uri->usage);
 #endif
       
-      new_uri->usage++;
+      RAPTOR_USAGE_INCR(world, new_uri->usage);
       
       goto unlock;
     }
@@ -153,6 +351,7 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 
   new_uri->world = world;
   new_uri->length = (unsigned int)length;
+  new_uri->hash = hash;
 
   new_string = RAPTOR_MALLOC(unsigned char*, length + 1);
   if(!new_string) {
@@ -167,9 +366,9 @@ raptor_new_uri_from_counted_string(raptor_world* world,
 
   new_uri->usage = 1; /* for user */
 
-  /* store in tree */
-  if(world->uris_tree) {
-    if(raptor_avltree_add(world->uris_tree, new_uri)) {
+  /* store in hash */
+  if(part) {
+    if(raptor_uri_hash_add(part, new_uri)) {
       RAPTOR_FREE(char*, new_string);
       RAPTOR_FREE(raptor_uri, new_uri);
       new_uri = NULL;
@@ -177,6 +376,8 @@ raptor_new_uri_from_counted_string(raptor_world* world,
   }
 
  unlock:
+  if(part)
+    RAPTOR_URI_HASH_UNLOCK(world, part);
 
   return new_uri;
 }
@@ -254,6 +455,53 @@ raptor_new_uri_from_uri_local_name(raptor_world* world, raptor_uri *uri,
 }
 
 
+/*
+ * raptor_uri_get_detail:
+ * @uri: URI
+ *
+ * INTERNAL - Get the parsed detail of a URI, parsing it on first use
+ *
+ * The detail is kept with the URI so that a base URI is parsed once
+ * however many references are resolved against it.
+ *
+ * Return value: shared detail or NULL on failure
+ */
+static raptor_uri_detail*
+raptor_uri_get_detail(raptor_uri* uri)
+{
+  raptor_uri_detail* ud;
+
+#ifdef RAPTOR_WORLD_THREADS
+  if(uri->world->thread_safe) {
+    raptor_uri_detail* existing = NULL;
+
+    ud = __atomic_load_n(&uri->detail, __ATOMIC_ACQUIRE);
+    if(ud)
+      return ud;
+
+    /* another thread may publish its detail first; keep that one */
+    ud = raptor_new_uri_detail(uri->string);
+    if(ud && !__atomic_compare_exchange_n(&uri->detail, &existing, ud, 0,
+                                          __ATOMIC_ACQ_REL,
+                                          __ATOMIC_ACQUIRE)) {
+      raptor_free_uri_detail(ud);
+      ud = existing;
+    }
+    return ud;
+  }
+#endif
+
+  ud = uri->detail;
+  if(!ud)
+    ud = uri->detail = raptor_new_uri_detail(uri->string);
+
+  return ud;
+}
+
+
+/* Size of buffer for resolving a URI without allocating */
+#define RAPTOR_URI_RESOLVE_BUFFER_SIZE 1024
+
 /**
  * raptor_new_uri_relative_to_base:
  * @world: raptor_world object
@@ -269,7 +517,8 @@ raptor_new_uri_relative_to_base(raptor_world* world,
                                 raptor_uri *base_uri, 
                                 const unsigned char *uri_string) 
 {
-  unsigned char *buffer;
+  unsigned char static_buffer[RAPTOR_URI_RESOLVE_BUFFER_SIZE];
+  unsigned char *buffer = static_buffer;
   size_t buffer_length;
   raptor_uri* new_uri;
   size_t actual_length;
@@ -287,15 +536,20 @@ raptor_new_uri_relative_to_base(raptor_world* world,
   
   /* +1 for adding any missing URI path '/' */
   buffer_length = base_uri->length + strlen((const char*)uri_string) + 1;
-  buffer = RAPTOR_MALLOC(unsigned char*, buffer_length + 1);
-  if(!buffer)
-    return NULL;
+  if(buffer_length + 1 > sizeof(static_buffer)) {
+    buffer = RAPTOR_MALLOC(unsigned char*, buffer_length + 1);
+    if(!buffer)
+      return NULL;
+  }
   
-  actual_length = raptor_uri_resolve_uri_reference(base_uri->string, uri_string,
-                                                   buffer, buffer_length);
+  actual_length = raptor_uri_resolve_uri_reference_detail(base_uri->string,
+                                                          raptor_uri_get_detail(base_uri),
+                                                          uri_string,
+                                                          buffer, buffer_length);
 
   new_uri = raptor_new_uri_from_counted_string(world, buffer, actual_length);
-  RAPTOR_FREE(char*, buffer);
+  if(buffer != static_buffer)
+    RAPTOR_FREE(char*, buffer);
   return new_uri;
 }
 
@@ -454,24 +708,52 @@ raptor_new_uri_from_uri_or_file_string(raptor_world* world,
 void
 raptor_free_uri(raptor_uri *uri)
 {
+  raptor_world* world;
+  raptor_uri_hash_part* part = NULL;
+  int usage;
+
   if(!uri)
     return;
 
-  uri->usage--;
+  world = uri->world;
+
+#ifdef RAPTOR_WORLD_THREADS
+  if(world->thread_safe) {
+    /* drop a reference that is not the last without locking */
+    usage = __atomic_load_n(&uri->usage, __ATOMIC_RELAXED);
+    while(usage > 1) {
+      if(__atomic_compare_exchange_n(&uri->usage, &usage, usage - 1, 0,
+                                     __ATOMIC_ACQ_REL, __ATOMIC_RELAXED))
+        return;
+    }
+  }
+#endif
+
+  /* the last reference must be dropped under the lock so that another
+   * thread cannot find the URI in the hash at the same time */
+  if(world->uris_hash) {
+    part = raptor_uri_hash_get_part(world, uri->hash);
+    RAPTOR_URI_HASH_LOCK(world, part);
+  }
+
+  usage = RAPTOR_USAGE_DECR(world, uri->usage);
   
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-  RAPTOR_DEBUG3("URI %s usage count now %d\n", uri->string, uri->usage);
+  RAPTOR_DEBUG3("URI %s usage count now %d\n", uri->string, usage);
 #endif
 
-  /* decrement usage, don't free if not 0 yet*/
-  if(uri->usage > 0) {
-    return;
+  if(part) {
+    /* decrement usage, don't free if not 0 yet*/
+    if(!usage)
+      raptor_uri_hash_delete(part, uri);
+    RAPTOR_URI_HASH_UNLOCK(world, part);
   }
 
-  /* this does not free the uri */
-  if(uri->world->uris_tree)
-    raptor_avltree_delete(uri->world->uris_tree, uri);
+  if(usage > 0)
+    return;
 
+  if(uri->detail)
+    raptor_free_uri_detail(uri->detail);
   if(uri->string)
     RAPTOR_FREE(char*, uri->string);
   RAPTOR_FREE(raptor_uri, uri);
@@ -561,7 +843,7 @@ raptor_uri_copy(raptor_uri *uri)
 {
   RAPTOR_ASSERT_OBJECT_POINTER_RETURN_VALUE(uri, raptor_uri, NULL);
   
-  uri->usage++;
+  RAPTOR_USAGE_INCR(uri->world, uri->usage);
   return uri;
 }
 
@@ -1091,30 +1373,70 @@ raptor_new_uri_for_retrieval(raptor_uri* old_uri)
 int
 raptor_uri_init(raptor_world* world)
 {
-  if(world->uri_interning && !world->uris_tree) {
-    world->uris_tree = raptor_new_avltree((raptor_data_compare_handler)raptor_uri_compare,
-                                          /* free */ NULL, 0);
-    if(!world->uris_tree) {
-#ifdef RAPTOR_DEBUG
-      RAPTOR_FATAL1("Failed to create raptor URI avltree");
-#else
-      raptor_log_error(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
-                       "Failed to create raptor URI avltree");
+  if(world->uri_interning && !world->uris_hash) {
+    unsigned int parts_count = 1;
+    unsigned int size = RAPTOR_URI_HASH_INITIAL_SIZE;
+    unsigned int i;
+
+    if(world->thread_safe) {
+      parts_count = RAPTOR_URI_HASH_THREAD_PARTS;
+      size = RAPTOR_URI_HASH_INITIAL_SIZE / RAPTOR_URI_HASH_THREAD_PARTS;
+    }
+
+    world->uris_hash = RAPTOR_CALLOC(raptor_uri_hash_part*, parts_count,
+                                     sizeof(raptor_uri_hash_part));
+    if(!world->uris_hash)
+      goto failed;
+    world->uris_hash_parts_count = parts_count;
+
+    for(i = 0; i < parts_count; i++) {
+      raptor_uri_hash_part* part = &world->uris_hash[i];
+
+      part->uris = RAPTOR_CALLOC(raptor_uri**, size, sizeof(raptor_uri*));
+      if(!part->uris) {
+        raptor_uri_finish(world);
+        goto failed;
+      }
+      part->size = size;
+      part->count = 0;
+#ifdef RAPTOR_WORLD_THREADS
+      pthread_mutex_init(&part->lock, NULL);
 #endif
     }
-    
   }
 
   return 0;
+
+  failed:
+#ifdef RAPTOR_DEBUG
+  RAPTOR_FATAL1("Failed to create raptor URI hash");
+#else
+  raptor_log_error(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                   "Failed to create raptor URI hash");
+#endif
+  return 0;
 }
 
 
 void
 raptor_uri_finish(raptor_world* world)
 {
-  if(world->uris_tree) {
-    raptor_free_avltree(world->uris_tree);
-    world->uris_tree = NULL;
+  if(world->uris_hash) {
+    unsigned int i;
+
+    for(i = 0; i < world->uris_hash_parts_count; i++) {
+      raptor_uri_hash_part* part = &world->uris_hash[i];
+
+      if(part->uris) {
+        RAPTOR_FREE(raptor_uri**, part->uris);
+#ifdef RAPTOR_WORLD_THREADS
+        pthread_mutex_destroy(&part->lock);
+#endif
+      }
+    }
+    RAPTOR_FREE(raptor_uri_hash_part*, world->uris_hash);
+    world->uris_hash = NULL;
+    world->uris_hash_parts_count = 0;
   }
 }
 
@@ -1653,6 +1975,53 @@ int main(int argc, char *argv[]);
 static const char *program;
 
 
+/* count the interned URIs in all parts of the hash */
+static unsigned int
+uri_hash_count(raptor_world* world)
+{
+  unsigned int count = 0;
+  unsigned int i;
+
+  for(i = 0; i < world->uris_hash_parts_count; i++)
+    count += world->uris_hash[i].count;
+
+  return count;
+}
+
+
+#ifdef RAPTOR_WORLD_THREADS
+#define URI_THREADS_TEST_THREADS 4
+#define URI_THREADS_TEST_COUNT 200
+#define URI_THREADS_TEST_ROUNDS 50
+
+/* intern and free the same URIs as the other threads */
+static void*
+uri_threads_test_worker(void* arg)
+{
+  raptor_world* world = (raptor_world*)arg;
+  raptor_uri* uris[URI_THREADS_TEST_COUNT];
+  unsigned char buffer[40];
+  int round;
+  int j;
+
+  for(round = 0; round < URI_THREADS_TEST_ROUNDS; round++) {
+    for(j = 0; j < URI_THREADS_TEST_COUNT; j++) {
+      sprintf((char*)buffer, "http://example.org/shared/%d", j);
+      uris[j] = raptor_new_uri(world, buffer);
+      if(!uris[j])
+        return arg;
+      raptor_free_uri(raptor_uri_copy(uris[j]));
+    }
+
+    for(j = 0; j < URI_THREADS_TEST_COUNT; j++)
+      raptor_free_uri(uris[j]);
+  }
+
+  return NULL;
+}
+#endif
+
+
 static int
 assert_uri_is_valid(raptor_uri* uri)
 {
@@ -1757,6 +2126,68 @@ assert_uri_to_relative(raptor_world *world, const char *base, const char *uri, c
 }
 
 
+/*
+ * Time interning COUNT distinct DBpedia-style URIs, looking each of
+ * them up 4 more times in a scattered order and then freeing them all.
+ */
+static int
+bench_intern(long count)
+{
+  raptor_world *world;
+  raptor_uri **uris;
+  unsigned char buffer[64];
+  clock_t start;
+  double insert_secs, lookup_secs, free_secs;
+  long i;
+  long index;
+
+  if(count <= 0)
+    return 1;
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world))
+    return 1;
+  uris = RAPTOR_CALLOC(raptor_uri**, RAPTOR_GOOD_CAST(size_t, count),
+                       sizeof(raptor_uri*));
+  if(!uris)
+    return 1;
+
+  start = clock();
+  for(i = 0; i < count; i++) {
+    sprintf((char*)buffer, "http://dbpedia.org/resource/Item_%ld", i);
+    uris[i] = raptor_new_uri(world, buffer);
+    if(!uris[i])
+      return 1;
+  }
+  insert_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  index = 0;
+  for(i = 0; i < 4 * count; i++) {
+    index = (index + 7919) % count;
+    sprintf((char*)buffer, "http://dbpedia.org/resource/Item_%ld", index);
+    raptor_free_uri(raptor_new_uri(world, buffer));
+  }
+  lookup_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  start = clock();
+  for(i = 0; i < count; i++)
+    raptor_free_uri(uris[i]);
+  free_secs = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  fprintf(stderr,
+          "%s: %ld URIs: insert %.1fns, lookup %.1fns, free %.1fns per URI\n",
+          program, count,
+          insert_secs * 1e9 / count, lookup_secs * 1e9 / (4 * count),
+          free_secs * 1e9 / count);
+
+  RAPTOR_FREE(raptor_uri**, uris);
+  raptor_free_world(world);
+
+  return 0;
+}
+
+
 int
 main(int argc, char *argv[]) 
 {
@@ -1777,16 +2208,20 @@ main(int argc, char *argv[])
 
   int failures = 0;
 
-  world = raptor_new_world();
-  if(!world || raptor_world_open(world))
-    exit(1);
-
   if((program = strrchr(argv[0], '/')))
     program++;
   else if((program = strrchr(argv[0], '\\')))
     program++;
   else
     program = argv[0];
+
+  /* raptor_uri_test COUNT runs a URI interning benchmark */
+  if(argc > 1)
+    return bench_intern(atol(argv[1]));
+
+  world = raptor_new_world();
+  if(!world || raptor_world_open(world))
+    exit(1);
   
 #ifdef WIN32
   failures += assert_filename_to_uri ("c:\\windows\\system", "file:///c:/windows/system");
@@ -1927,8 +2362,99 @@ main(int argc, char *argv[])
     raptor_free_uri(u2);
   }
 
+  /* Intern enough URIs to grow the hash, free every other one and
+   * check the rest are still found and shared */
+  if(1) {
+#define URI_HASH_TEST_COUNT 5000
+    raptor_uri* uris[URI_HASH_TEST_COUNT];
+    unsigned char buffer[40];
+    unsigned int count = uri_hash_count(world);
+    int j;
+
+    for(j = 0; j < URI_HASH_TEST_COUNT; j++) {
+      sprintf((char*)buffer, "http://example.org/resource/%d", j);
+      uris[j] = raptor_new_uri(world, buffer);
+    }
+
+    for(j = 0; j < URI_HASH_TEST_COUNT; j += 2) {
+      raptor_free_uri(uris[j]);
+      uris[j] = NULL;
+    }
+
+    for(j = 0; j < URI_HASH_TEST_COUNT; j++) {
+      raptor_uri* u;
+
+      sprintf((char*)buffer, "http://example.org/resource/%d", j);
+      u = raptor_new_uri(world, buffer);
+      if(uris[j] && u != uris[j]) {
+        fprintf(stderr, "%s: interned URI %s FAILED - got a new URI\n",
+                program, buffer);
+        failures++;
+      }
+      if(!uris[j])
+        uris[j] = u;
+      else
+        raptor_free_uri(u);
+    }
+
+    if(uri_hash_count(world) != count + URI_HASH_TEST_COUNT) {
+      fprintf(stderr, "%s: URI hash has %u URIs, expected %u\n",
+              program, uri_hash_count(world),
+              count + URI_HASH_TEST_COUNT);
+      failures++;
+    }
+
+    for(j = 0; j < URI_HASH_TEST_COUNT; j++)
+      raptor_free_uri(uris[j]);
+
+    if(uri_hash_count(world) != count) {
+      fprintf(stderr, "%s: URI hash has %u URIs after freeing, expected %u\n",
+              program, uri_hash_count(world), count);
+      failures++;
+    }
+  }
+
   raptor_free_world(world);
 
+#ifdef RAPTOR_WORLD_THREADS
+  /* Share one world between threads interning the same URIs */
+  if(1) {
+    pthread_t threads[URI_THREADS_TEST_THREADS];
+    unsigned int count;
+    void* result;
+    int j;
+
+    world = raptor_new_world();
+    if(!world ||
+       raptor_world_set_flag(world, RAPTOR_WORLD_FLAG_THREAD_SAFE, 1) ||
+       raptor_world_open(world)) {
+      fprintf(stderr, "%s: Failed to create thread safe world\n", program);
+      return failures + 1;
+    }
+
+    count = uri_hash_count(world);
+
+    for(j = 0; j < URI_THREADS_TEST_THREADS; j++)
+      pthread_create(&threads[j], NULL, uri_threads_test_worker, world);
+
+    for(j = 0; j < URI_THREADS_TEST_THREADS; j++) {
+      pthread_join(threads[j], &result);
+      if(result) {
+        fprintf(stderr, "%s: thread %d failed to create URIs\n", program, j);
+        failures++;
+      }
+    }
+
+    if(uri_hash_count(world) != count) {
+      fprintf(stderr, "%s: shared URI hash has %u URIs after threads, expected %u\n",
+              program, uri_hash_count(world), count);
+      failures++;
+    }
+
+    raptor_free_world(world);
+  }
+#endif
+
   return failures ;
 }
 
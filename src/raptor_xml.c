@@ -549,6 +549,116 @@ raptor_valid_xml_ID(raptor_parser *rdf_parser, const unsigned char *string)
 }
 
 
+/*
+ * Bytes the XML escapers copy unchanged, unless they are the quote:
+ * bit 0 in text, bit 1 in attribute values and bit 2 for non-ASCII
+ * UTF-8 when it is not checked.
+ */
+static const unsigned char raptor_xml_escape_plain[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 2, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+  3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+  4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4
+};
+
+
+/*
+ * raptor_xml_escape_byte:
+ * @c: US-ASCII byte that raptor_xml_escape_plain does not allow
+ * @quote: quote character or 0
+ * @xml_version: XML version - 10 (XML 1.0) or 11 (XML 1.1)
+ * @buf: buffer of at least 6 bytes to write the escape to
+ *
+ * INTERNAL - Format the XML escape for a byte
+ *
+ * Return value: length of the escape or <0 if the character is illegal in the XML version
+ */
+static int
+raptor_xml_escape_byte(unsigned char c, char quote, int xml_version,
+                       char *buf)
+{
+  static const char hex[16] = {
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', 'A', 'B', 'C', 'D', 'E', 'F'
+  };
+  int len = 3;
+
+  if(c == '&') {
+    memcpy(buf, "&amp;", 5);
+    return 5;
+  } else if(c == '<') {
+    memcpy(buf, "&lt;", 4);
+    return 4;
+  } else if(!quote && c == '>') {
+    memcpy(buf, "&gt;", 4);
+    return 4;
+  } else if(quote && c == RAPTOR_GOOD_CAST(unsigned char, quote)) {
+    memcpy(buf, (quote == '\'') ? "&apos;" : "&quot;", 6);
+    return 6;
+  }
+
+  if(!(c == 0x0d || (quote && (c == 0x09 || c == 0x0a)))) {
+    /* 0x7f or a control character other than tab and newline */
+    if(!c || xml_version < 11)
+      return -1;
+  }
+
+  /* &#xX; or &#xXX; */
+  memcpy(buf, "&#x", 3);
+  if(c > 0x0f)
+    buf[len++] = hex[c >> 4];
+  buf[len++] = hex[c & 0xf];
+  buf[len++] = ';';
+
+  return len;
+}
+
+
+/*
+ * raptor_xml_utf8_span:
+ * @string: string starting with a non-ASCII byte
+ * @length: length of string
+ *
+ * INTERNAL - Find the length of the run of UTF-8 characters starting with a non-ASCII byte
+ *
+ * Characters are checked as raptor_unicode_utf8_string_get_char()
+ * decodes them.
+ *
+ * Return value: length of the run, which stops early at any bad UTF-8
+ */
+static size_t
+raptor_xml_utf8_span(const unsigned char *string, size_t length)
+{
+  size_t i = 0;
+
+  while(i < length && string[i] > 0x7f) {
+    raptor_unichar unichar;
+    int unichar_len;
+
+    unichar_len = raptor_unicode_utf8_string_get_char(string + i, length - i,
+                                                      &unichar);
+    if(unichar_len < 0 ||
+       RAPTOR_GOOD_CAST(size_t, unichar_len) > length - i)
+      break;
+    i += RAPTOR_GOOD_CAST(size_t, unichar_len);
+  }
+
+  return i;
+}
+
+
 /**
  * raptor_xml_escape_string_any:
  * @world: raptor world
@@ -601,12 +711,13 @@ raptor_xml_escape_string_any(raptor_world *world,
                              char quote,
                              int xml_version)
 {
-  size_t l;
   size_t new_len = 0;
   const unsigned char *p;
+  const unsigned char *end;
   unsigned char *q;
-  int unichar_len;
-  raptor_unichar unichar;
+  unsigned char plain_mask;
+  char escape[6];
+  int escape_len;
 
   if(!string)
     return -1;
@@ -618,49 +729,39 @@ raptor_xml_escape_string_any(raptor_world *world,
   if(quote != '\"' && quote != '\'')
     quote='\0';
 
-  for(l = len, p = string; l; p++, l--) {
+  plain_mask = quote ? 2 : 1;
+  end = string + len;
+
+  for(p = string; p < end; ) {
+    const unsigned char *start = p;
+
+    while(p < end && (raptor_xml_escape_plain[*p] & plain_mask) &&
+          *p != RAPTOR_GOOD_CAST(unsigned char, quote))
+      p++;
+    new_len += RAPTOR_GOOD_CAST(size_t, p - start);
+    if(p == end)
+      break;
+
     if(*p > 0x7f) {
-      unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
-      if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > l) {
+      size_t run = raptor_xml_utf8_span(p, RAPTOR_GOOD_CAST(size_t, end - p));
+      if(!run) {
         raptor_log_error(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
                          "Bad UTF-8 encoding.");
         return -1;
       }
-    } else {
-      unichar=*p;
-      unichar_len = 1;
+      new_len += run;
+      p += run;
+      continue;
     }
-  
-    if(unichar == '&')
-      /* &amp; */
-      new_len+= 5;
-    else if(unichar == '<' || (!quote && unichar == '>'))
-      /* &lt; or &gt; */
-      new_len+= 4;
-    else if(quote && unichar == (unsigned long)quote)
-      /* &apos; or &quot; */
-      new_len+= 6;
-    else if(unichar == 0x0d ||
-             (quote && (unichar == 0x09 || unichar == 0x0a)))
-      /* &#xD; or &#x9; or &xA; */
-      new_len+= 5;
-    else if(unichar == 0x7f ||
-             (unichar < 0x20 && unichar != 0x09 && unichar != 0x0a)) {
-      if(!unichar || xml_version < 11) {
-        raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
-                                   "Cannot write illegal XML 1.0 character U+%6lX.",
-                                   unichar);
-      } else {
-        /* &#xX; */
-        new_len+= 5;
-        if(unichar > 0x0f)
-          new_len++;
-      }
-    } else
-      new_len+= unichar_len;
 
-    unichar_len--; /* since loop does len-- */
-    p += unichar_len; l -= unichar_len;
+    escape_len = raptor_xml_escape_byte(*p, quote, xml_version, escape);
+    if(escape_len < 0)
+      raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                                 "Cannot write illegal XML 1.0 character U+%6lX.",
+                                 RAPTOR_GOOD_CAST(unsigned long, *p));
+    else
+      new_len += RAPTOR_GOOD_CAST(size_t, escape_len);
+    p++;
   }
 
   if(length && new_len > length)
@@ -669,64 +770,34 @@ raptor_xml_escape_string_any(raptor_world *world,
   if(!buffer)
     return RAPTOR_BAD_CAST(int, new_len);
   
-  for(l = len, p = string, q = buffer; l; p++, l--) {
-    if(*p > 0x7f) {
-      unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
+  for(p = string, q = buffer; p < end; ) {
+    const unsigned char *start = p;
+    size_t run;
+
+    while(p < end && (raptor_xml_escape_plain[*p] & plain_mask) &&
+          *p != RAPTOR_GOOD_CAST(unsigned char, quote))
+      p++;
+    if(p < end && *p > 0x7f)
       /* if the UTF-8 encoding is bad, we already did return -1 above */
-    } else {
-      unichar=*p;
-      unichar_len = 1;
-    }
+      p += raptor_xml_utf8_span(p, RAPTOR_GOOD_CAST(size_t, end - p));
 
-    if(unichar == '&') {
-      memcpy(q, "&amp;", 5);
-      q+= 5;
-    } else if(unichar == '<') {
-      memcpy(q, "&lt;", 4);
-      q+= 4;
-    } else if(!quote && unichar == '>') {
-      memcpy(q, "&gt;", 4);
-      q+= 4;
-    } else if(quote && unichar == (unsigned long)quote) {
-      if(quote == '\'')  
-        memcpy(q, "&apos;", 6);
-      else
-        memcpy(q, "&quot;", 6);
-      q+= 6;
-    } else if(unichar == 0x0d ||
-               (quote && (unichar == 0x09 || unichar == 0x0a))) {
-      /* &#xX; */
-      *q++='&';
-      *q++='#';
-      *q++='x';
-      if(unichar == 0x09)
-        *q++ = '9';
-      else
-        *q++ = 'A'+ ((char)unichar-0x0a);
-      *q++= ';';
-    } else if(unichar == 0x7f ||
-               (unichar < 0x20 && unichar != 0x09 && unichar != 0x0a)) {
-      if(!unichar || xml_version < 11) {
-        raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
-                                   "Cannot write illegal XML 1.0 character U+%6lX.",
-                                   unichar);
-      } else {
-        /* &#xX; */
-        *q++ = '&';
-        *q++ = '#';
-        *q++ = 'x';
-        q += raptor_format_integer((char*)q, 3, 
-                                   RAPTOR_GOOD_CAST(unsigned int, unichar), 
-                                   /* base */ 16, -1, '\0');
-        *q++ = ';';
-      }
-    } else {
-      memcpy(q, p, unichar_len);
-      q+= unichar_len;
+    run = RAPTOR_GOOD_CAST(size_t, p - start);
+    if(run) {
+      memcpy(q, start, run);
+      q += run;
+      continue;
     }
 
-    unichar_len--; /* since loop does len-- */
-    p += unichar_len; l -= unichar_len;
+    escape_len = raptor_xml_escape_byte(*p, quote, xml_version, escape);
+    if(escape_len < 0)
+      raptor_log_error_formatted(world, RAPTOR_LOG_LEVEL_ERROR, NULL,
+                                 "Cannot write illegal XML 1.0 character U+%6lX.",
+                                 RAPTOR_GOOD_CAST(unsigned long, *p));
+    else {
+      memcpy(q, escape, escape_len);
+      q += escape_len;
+    }
+    p++;
   }
 
   /* Terminate new string */
@@ -794,8 +865,40 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
                                     int xml_version,
                                     raptor_iostream* iostr)
 {
-  size_t l;
-  const unsigned char *p;
+  return raptor_xml_escape_string_common_write(string, len, quote,
+                                               xml_version, 1, iostr);
+}
+
+
+/*
+ * raptor_xml_escape_string_common_write:
+ * @string: string to XML escape (UTF-8)
+ * @len: length of string
+ * @quote: optional quote character to escape for attribute content, or 0
+ * @xml_version: XML version - 10 (XML 1.0) or 11 (XML 1.1)
+ * @check_utf8: non-0 to check the UTF-8 encoding of @string
+ * @iostr: the #raptor_iostream to write to
+ *
+ * INTERNAL - raptor_xml_escape_string_any_write() with optional UTF-8 checking
+ *
+ * If @check_utf8 is 0, non-ASCII bytes are copied as they are, which
+ * is only safe for input that is already known to be valid UTF-8.
+ *
+ * Return value: non 0 on failure
+ */
+int
+raptor_xml_escape_string_common_write(const unsigned char *string,
+                                      size_t len,
+                                      char quote,
+                                      int xml_version,
+                                      int check_utf8,
+                                      raptor_iostream* iostr)
+{
+  const unsigned char *p = string;
+  const unsigned char *end = string + len;
+  unsigned char plain_mask;
+  char escape[6];
+  int escape_len;
 
   if(xml_version != 10)
     xml_version = 11;
@@ -803,60 +906,46 @@ raptor_xml_escape_string_any_write(const unsigned char *string,
   if(quote != '\"' && quote != '\'')
     quote='\0';
 
-  for(l = len, p = string; l; p++, l--) {
-    int unichar_len = 1;
-    raptor_unichar unichar=*p;
+  plain_mask = quote ? 2 : 1;
+  if(!check_utf8)
+    plain_mask |= 4;
+
+  while(p < end) {
+    const unsigned char *start = p;
+
+    /* Write the run of bytes that need no escaping in one go */
+    while(p < end && (raptor_xml_escape_plain[*p] & plain_mask) &&
+          *p != RAPTOR_GOOD_CAST(unsigned char, quote))
+      p++;
+    if(p != start)
+      raptor_iostream_put_counted_string(start,
+                                         RAPTOR_GOOD_CAST(size_t, p - start),
+                                         iostr);
+    if(p == end)
+      break;
 
     if(*p > 0x7f) {
-      unichar_len = raptor_unicode_utf8_string_get_char(p, l, &unichar);
-      if(unichar_len < 0 || RAPTOR_GOOD_CAST(size_t, unichar_len) > l) {
+      size_t run = raptor_xml_utf8_span(p, RAPTOR_GOOD_CAST(size_t, end - p));
+      if(!run) {
         raptor_log_error(raptor_iostream_get_world(iostr),
                          RAPTOR_LOG_LEVEL_ERROR, NULL,
                          "Bad UTF-8 encoding.");
         return 1;
       }
+      raptor_iostream_put_counted_string(p, run, iostr);
+      p += run;
+      continue;
     }
 
-    if(unichar == '&')
-      raptor_iostream_counted_string_write("&amp;", 5, iostr);
-    else if(unichar == '<')
-      raptor_iostream_counted_string_write("&lt;", 4, iostr);
-    else if(!quote && unichar == '>')
-      raptor_iostream_counted_string_write("&gt;", 4, iostr);
-    else if(quote && unichar == (unsigned long)quote) {
-      if(quote == '\'')  
-        raptor_iostream_counted_string_write("&apos;", 6, iostr);
-      else
-        raptor_iostream_counted_string_write("&quot;", 6, iostr);
-    } else if(unichar == 0x0d ||
-               (quote && (unichar == 0x09 || unichar == 0x0a))) {
-      /* &#xX; */
-      raptor_iostream_counted_string_write("&#x", 3, iostr);
-      if(unichar == 0x09)
-        raptor_iostream_write_byte('9', iostr);
-      else
-        raptor_iostream_write_byte('A'+ ((char)unichar-0x0a), iostr);
-      raptor_iostream_write_byte(';', iostr);
-    } else if(unichar == 0x7f ||
-               (unichar < 0x20 && unichar != 0x09 && unichar != 0x0a)) {
-      if(!unichar || xml_version < 11) {
-        raptor_log_error_formatted(raptor_iostream_get_world(iostr),
-                                   RAPTOR_LOG_LEVEL_ERROR, NULL,
-                                   "Cannot write illegal XML 1.0 character U+%6lX.",
-                                   unichar);
-      } else {
-        int width = (unichar < 0x10) ? 1 : 2;
-
-        /* &#xX; */
-        raptor_iostream_counted_string_write("&#x", 3, iostr);
-        raptor_iostream_hexadecimal_write(RAPTOR_GOOD_CAST(unsigned int, unichar), width, iostr);
-        raptor_iostream_write_byte(';', iostr);
-      }
-    } else
-      raptor_iostream_counted_string_write((const char*)p, unichar_len, iostr);
-
-    unichar_len--; /* since loop does len-- */
-    p += unichar_len; l -= unichar_len;
+    escape_len = raptor_xml_escape_byte(*p, quote, xml_version, escape);
+    if(escape_len < 0)
+      raptor_log_error_formatted(raptor_iostream_get_world(iostr),
+                                 RAPTOR_LOG_LEVEL_ERROR, NULL,
+                                 "Cannot write illegal XML 1.0 character U+%6lX.",
+                                 RAPTOR_GOOD_CAST(unsigned long, *p));
+    else
+      raptor_iostream_put_counted_string(escape, escape_len, iostr);
+    p++;
   }
 
   return 0;
@@ -1010,6 +1099,8 @@ main(int argc, char *argv[])
 
     {"&amp;", 0, "&amp;amp;"},
     {"<foo>", 0, "&lt;foo&gt;"},
+    {"caf\xc3\xa9 & \xe6\x9d\xb1\xe4\xba\xac", 0, "caf\xc3\xa9 &amp; \xe6\x9d\xb1\xe4\xba\xac"},
+    {"'\xc3\xa9'\x0a", '\'', "&apos;\xc3\xa9&apos;&#xA;"},
 #if 0
     {"\x1f", 0, "&#x1F;"},
     {"\xc2\x80", 0, "&#x80;"},
@@ -1039,6 +1130,7 @@ main(int argc, char *argv[])
     size_t utf8_string_len = strlen((const char*)utf8_string);
     unsigned char *xml_string;
     int xml_string_len = 0;
+    int check_utf8;
 
     xml_string_len = raptor_xml_escape_string(world, 
                                               utf8_string, utf8_string_len,
@@ -1080,6 +1172,34 @@ main(int argc, char *argv[])
             program, xml_string);
 #endif
     RAPTOR_FREE(char*, xml_string);
+
+    /* the iostream escaper must agree, with and without UTF-8 checks */
+    for(check_utf8 = 0; check_utf8 < 2; check_utf8++) {
+      raptor_iostream *iostr;
+      void *string = NULL;
+      size_t string_len = 0;
+
+      iostr = raptor_new_iostream_to_string(world, &string, &string_len, NULL);
+      if(!iostr) {
+        failures++;
+        break;
+      }
+      raptor_xml_escape_string_common_write(utf8_string, utf8_string_len,
+                                            RAPTOR_GOOD_CAST(char, quote), 10,
+                                            check_utf8, iostr);
+      raptor_free_iostream(iostr);
+
+      if(!string || strcmp((const char*)string, t->result)) {
+        fprintf(stderr, "%s: raptor_xml_escape_string_common_write (check_utf8 %d) FAILED to escape string '",
+                program, check_utf8);
+        raptor_bad_string_print(utf8_string, stderr);
+        fprintf(stderr, "', expected '%s', result was '%s'\n",
+                t->result, string ? (const char*)string : "NULL");
+        failures++;
+      }
+      if(string)
+        raptor_free_memory(string);
+    }
   }
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1    
@@ -54,6 +54,7 @@
 #define XML_WRITER_AUTO_EMPTY(xml_writer) RAPTOR_OPTIONS_GET_NUMERIC(xml_writer, RAPTOR_OPTION_WRITER_AUTO_EMPTY)
 #define XML_WRITER_INDENT(xml_writer) RAPTOR_OPTIONS_GET_NUMERIC(xml_writer, RAPTOR_OPTION_WRITER_INDENT_WIDTH)
 #define XML_WRITER_XML_VERSION(xml_writer) RAPTOR_OPTIONS_GET_NUMERIC(xml_writer, RAPTOR_OPTION_WRITER_XML_VERSION)
+#define XML_WRITER_CHECK_UTF8(xml_writer) (!RAPTOR_OPTIONS_GET_NUMERIC(xml_writer, RAPTOR_OPTION_WRITER_XML_TRUST_UTF8))
 
 
 #define XML_WRITER_FLUSH_CLOSE_BRACKET(xml_writer)              \
@@ -329,11 +330,12 @@ raptor_xml_writer_start_element_common(raptor_xml_writer* xml_writer,
       
       raptor_iostream_counted_string_write("=\"", 2, iostr);
       
-      raptor_xml_escape_string_any_write(element->attributes[i]->value, 
-                                          element->attributes[i]->value_length,
-                                          '"',
-                                          xml_version,
-                                          iostr);
+      raptor_xml_escape_string_common_write(element->attributes[i]->value, 
+                                            element->attributes[i]->value_length,
+                                            '"',
+                                            xml_version,
+                                            XML_WRITER_CHECK_UTF8(xml_writer),
+                                            iostr);
       raptor_iostream_write_byte('"', iostr);
     }
   }
@@ -626,10 +628,11 @@ raptor_xml_writer_cdata(raptor_xml_writer* xml_writer,
 
   XML_WRITER_FLUSH_CLOSE_BRACKET(xml_writer);
   
-  raptor_xml_escape_string_any_write(s, strlen((const char*)s),
-                                      '\0',
-                                      XML_WRITER_XML_VERSION(xml_writer),
-                                      xml_writer->iostr);
+  raptor_xml_escape_string_common_write(s, strlen((const char*)s),
+                                        '\0',
+                                        XML_WRITER_XML_VERSION(xml_writer),
+                                        XML_WRITER_CHECK_UTF8(xml_writer),
+                                        xml_writer->iostr);
 
   if(xml_writer->current_element)
     xml_writer->current_element->content_cdata_seen = 1;
@@ -656,10 +659,11 @@ raptor_xml_writer_cdata_counted(raptor_xml_writer* xml_writer,
 
   XML_WRITER_FLUSH_CLOSE_BRACKET(xml_writer);
   
-  raptor_xml_escape_string_any_write(s, len,
-                                      '\0',
-                                      XML_WRITER_XML_VERSION(xml_writer),
-                                      xml_writer->iostr);
+  raptor_xml_escape_string_common_write(s, len,
+                                        '\0',
+                                        XML_WRITER_XML_VERSION(xml_writer),
+                                        XML_WRITER_CHECK_UTF8(xml_writer),
+                                        xml_writer->iostr);
 
   if(xml_writer->current_element)
     xml_writer->current_element->content_cdata_seen = 1;
@@ -46,41 +46,35 @@
 #include "raptor_internal.h"
 
 
-/**
- * raptor_stringbuffer_append_turtle_string:
- * @stringbuffer: String buffer to add to
+/*
+ * raptor_turtle_unescape_string:
  * @text: turtle string to decode
  * @len: length of string
  * @delim: terminating delimiter for string - only ', " or &gt; are allowed
+ * @dest: buffer of at least @len + 1 bytes to write the decoded string to
+ * @dest_len_p: pointer to store the decoded length
  * @error_handler: error handling function
  * @error_data: error handler data
  *
- * Append to a stringbuffer a Turtle-escaped string.
+ * INTERNAL - Decode a Turtle-escaped string into a buffer
  *
- * The passed in string is handled according to the Turtle string
- * escape rules giving a UTF-8 encoded output of the Unicode codepoints.
+ * Decoding never makes a string longer so @dest needs no more room
+ * than @text plus a NUL.
  *
- * The Turtle escapes are \n \r \t \\
- * \uXXXX \UXXXXXXXX where X is [A-F0-9]
- * 
  * Return value: non-0 on failure
- **/
+ */
 int
-raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer,
-                                         const unsigned char *text,
-                                         size_t len, int delim,
-                                         raptor_simple_message_handler error_handler, 
-                                         void *error_data)
+raptor_turtle_unescape_string(const unsigned char *text, size_t len,
+                              int delim,
+                              unsigned char *dest, size_t *dest_len_p,
+                              raptor_simple_message_handler error_handler,
+                              void *error_data)
 {
   size_t i;
   const unsigned char *s;
   unsigned char *d;
-  unsigned char *string = RAPTOR_MALLOC(unsigned char*, len + 1);
-  
-  if(!string)
-    return -1;
 
-  for(s = text, d = string, i = 0; i < len; s++, i++) {
+  for(s = text, d = dest, i = 0; i < len; s++, i++) {
     unsigned char c=*s;
 
     if(c == '\\' ) {
@@ -97,23 +91,31 @@ raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer,
       else if(c == 'u' || c == 'U') {
         size_t ulen = (c == 'u') ? 4 : 8;
         unsigned long unichar = 0;
-        int n;
+        size_t n;
         
         s++; i++;
         if(i+ulen > len) {
           error_handler(error_data,
                         "Turtle string error - \\%c over end of line", c);
-          RAPTOR_FREE(char*, string);
           return 1;
         }
         
-        n = sscanf((const char*)s, ((ulen == 4) ? "%04lx" : "%08lx"), &unichar);
-        if(n != 1) {
-          error_handler(error_data,
-                        "Turtle string error - illegal Uncode escape '%c%s...'",
-                        c, s);
-          RAPTOR_FREE(char*, string);
-          return 1;
+        for(n = 0; n < ulen; n++) {
+          int h = s[n];
+
+          if(h >= '0' && h <= '9')
+            h -= '0';
+          else if(h >= 'A' && h <= 'F')
+            h -= 'A' - 10;
+          else if(h >= 'a' && h <= 'f')
+            h -= 'a' - 10;
+          else {
+            error_handler(error_data,
+                          "Turtle string error - illegal Uncode escape '%c%.*s...'",
+                          c, (int)ulen, s);
+            return 1;
+          }
+          unichar = (unichar << 4) | (unsigned long)h;
         }
 
         s+= ulen-1;
@@ -123,30 +125,68 @@ raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer,
           error_handler(error_data,
                         "Turtle string error - illegal Unicode character with code point #x%lX (max #x%lX).", 
                         unichar, raptor_unicode_max_codepoint);
-          RAPTOR_FREE(char*, string);
           return 1;
         }
           
-        d += raptor_unicode_utf8_string_put_char(unichar, d, len-(d-string));
+        d += raptor_unicode_utf8_string_put_char(unichar, d, len-(d-dest));
 
       } else {
         /* don't handle \x where x isn't one of: \t \n \r \\ (delim) */
         error_handler(error_data,
-                      "Turtle string error - illegal escape \\%c (#x%02X) in \"%s\"", 
-                      c, c, text);
+                      "Turtle string error - illegal escape \\%c (#x%02X) in \"%.*s\"", 
+                      c, c, (int)len, text);
       }
     } else
       *d++=c;
   }
   *d='\0';
 
-  /* calculate output string size */
-  len = d-string;
+  *dest_len_p = d - dest;
+
+  return 0;
+}
+
+
+/**
+ * raptor_stringbuffer_append_turtle_string:
+ * @stringbuffer: String buffer to add to
+ * @text: turtle string to decode
+ * @len: length of string
+ * @delim: terminating delimiter for string - only ', " or &gt; are allowed
+ * @error_handler: error handling function
+ * @error_data: error handler data
+ *
+ * Append to a stringbuffer a Turtle-escaped string.
+ *
+ * The passed in string is handled according to the Turtle string
+ * escape rules giving a UTF-8 encoded output of the Unicode codepoints.
+ *
+ * The Turtle escapes are \n \r \t \\
+ * \uXXXX \UXXXXXXXX where X is [A-F0-9]
+ * 
+ * Return value: non-0 on failure
+ **/
+int
+raptor_stringbuffer_append_turtle_string(raptor_stringbuffer* stringbuffer,
+                                         const unsigned char *text,
+                                         size_t len, int delim,
+                                         raptor_simple_message_handler error_handler, 
+                                         void *error_data)
+{
+  unsigned char *string = RAPTOR_MALLOC(unsigned char*, len + 1);
   
+  if(!string)
+    return -1;
+
+  if(raptor_turtle_unescape_string(text, len, delim, string, &len,
+                                   error_handler, error_data)) {
+    RAPTOR_FREE(char*, string);
+    return 1;
+  }
+
   /* string gets owned by the stringbuffer after this */
   return raptor_stringbuffer_append_counted_string(stringbuffer, 
                                                    string, len, 0);
-
 }
 
 
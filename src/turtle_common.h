@@ -38,6 +38,21 @@ raptor_uri* turtle_qname_to_uri(raptor_parser *rdf_parser, unsigned char *name,
 extern void turtle_token_free(raptor_world* world, int token, YYSTYPE *lval);
 
 
+/* Scratch buffers: two for string tokens and one for URIs */
+#define TURTLE_SCRATCH_COUNT 3
+#define TURTLE_SCRATCH_URI 2
+
+/*
+ * Subject and predicate that the grammar is reading objects for:
+ * one for the statement plus one for each [ ] or ( ) open in it
+ */
+typedef struct {
+  raptor_term* subject;
+  raptor_term* predicate;
+  /* collection only: last list node, NULL before the first item */
+  raptor_term* tail;
+} raptor_turtle_frame;
+
 /*
  * Turtle parser object
  */
@@ -47,7 +62,42 @@ struct raptor_turtle_parser_s {
 
   /* buffer length */
   size_t buffer_length;
-  
+
+  /* allocated size of buffer */
+  size_t buffer_size;
+
+  /* incremental parsing: offset in buffer to resume scanning for
+   * statement ends, lexical state, [ ( depth and TRIG graph { depth
+   * at that offset
+   */
+  size_t scan_offset;
+  int scan_state;
+  int scan_depth;
+  int scan_graph_depth;
+
+  /* incremental parsing: offset just after a top-level TRIG graph
+   * '}' that may end a statement, or 0
+   */
+  size_t scan_graph_end;
+
+  /* incremental parsing: length of buffer prefix holding only
+   * complete statements that can be parsed now and non-0 if it ends
+   * inside a TRIG graph
+   */
+  size_t consumable;
+  int consumable_in_graph;
+
+  /* incremental parsing: non-0 if the last prefix parsed ended
+   * inside a TRIG graph so the next one starts inside it
+   */
+  int graph_open;
+
+  /* incremental parsing: set while parsing a prefix to make the lexer
+   * return GRAPH_CONTINUE first and GRAPH_SUSPEND at the end
+   */
+  int graph_continue;
+  int graph_suspend;
+
   /* static statement for use in passing to user code */
   raptor_statement statement;
 
@@ -63,8 +113,16 @@ struct raptor_turtle_parser_s {
 
   int lineno;
 
-  /* for creating long literals */
-  raptor_stringbuffer* sb;
+  /* lexer scratch buffers for decoding escaped strings and long
+   * literals, alternating between the two for string tokens; see
+   * turtle_lexer.l for how long a token stays valid
+   */
+  unsigned char* scratch[TURTLE_SCRATCH_COUNT];
+  size_t scratch_size[TURTLE_SCRATCH_COUNT];
+  int scratch_index;
+
+  /* length of long literal decoded so far in scratch[scratch_index] */
+  size_t long_literal_length;
 
   /* count of errors in current parse */
   int error_count;
@@ -72,6 +130,21 @@ struct raptor_turtle_parser_s {
   /* TRIG graph name */
   raptor_term* graph_name;
 
+  /* recently used URI terms */
+  raptor_term_cache term_cache;
+
+  /* datatypes of numeric and boolean literals */
+  raptor_uri* xsd_boolean_uri;
+  raptor_uri* xsd_decimal_uri;
+  raptor_uri* xsd_double_uri;
+  raptor_uri* xsd_integer_uri;
+
+  /* stack of subject/predicate frames; triples are emitted as each
+   * object is read rather than collected per statement */
+  raptor_turtle_frame* frames;
+  int frames_count;
+  int frames_size;
+
   /* Allow TRIG extensions */
   int trig : 1;
 };
@@ -55,6 +55,8 @@
 
 #define YY_DECL int turtle_lexer_lex (YYSTYPE *turtle_parser_lval, yyscan_t yyscanner)
 #define YY_NO_UNISTD_H 1
+/* bison may already have defined yylex; the lexer header defines it too */
+#undef yylex
 #include <turtle_lexer.h>
 
 #include <turtle_common.h>
@@ -101,7 +103,13 @@ extern int turtle_lexer_lex (YYSTYPE *turtle_parser_lval, yyscan_t scanner);
 
 
 /* Prototypes for local functions */
-static void raptor_turtle_generate_statement(raptor_parser *parser, raptor_statement *triple);
+static void raptor_turtle_generate_statement(raptor_parser *parser, raptor_term *subject, raptor_term *predicate, raptor_term *object);
+static int raptor_turtle_push_frame(raptor_parser *parser, raptor_term *subject);
+static raptor_term* raptor_turtle_pop_frame(raptor_parser *parser);
+static void raptor_turtle_clear_frames(raptor_turtle_parser *turtle_parser);
+static void raptor_turtle_set_predicate(raptor_parser *parser, raptor_term *predicate);
+static void raptor_turtle_emit_object(raptor_parser *parser, raptor_term *object);
+static int raptor_turtle_add_collection_item(raptor_parser *parser, raptor_term *object);
 
 %}
 
@@ -120,9 +128,13 @@ static void raptor_turtle_generate_statement(raptor_parser *parser, raptor_state
 
 /* Interface between lexer and parser */
 %union {
-  unsigned char *string;
+  /* string token: a slice of the lexer input or scratch buffer that
+   * is not NUL terminated; see turtle_lexer.l for how long it lives */
+  struct {
+    const unsigned char *string;
+    size_t length;
+  } text;
   raptor_term *identifier;
-  raptor_sequence *sequence;
   raptor_uri *uri;
   int integer; /* 0+ for a xsd:integer datatyped RDF literal */
 }
@@ -150,29 +162,27 @@ static void raptor_turtle_generate_statement(raptor_parser *parser, raptor_state
 %token BASE "@base"
 
 /* literals */
-%token <string> STRING_LITERAL "string literal"
+%token <text> STRING_LITERAL "string literal"
 %token <uri> URI_LITERAL "URI literal"
 %token <uri> GRAPH_NAME_LEFT_CURLY "Graph URI literal {"
-%token <string> BLANK_LITERAL "blank node"
+
+/* incremental TRIG parsing: resume or leave open the current graph */
+%token GRAPH_CONTINUE "graph continuation"
+%token GRAPH_SUSPEND "graph suspension"
+%token <text> BLANK_LITERAL "blank node"
 %token <uri> QNAME_LITERAL "QName"
-%token <string> IDENTIFIER "identifier"
-%token <string> INTEGER_LITERAL "integer literal"
-%token <string> FLOATING_LITERAL "floating point literal"
-%token <string> DECIMAL_LITERAL "decimal literal"
+%token <text> IDENTIFIER "identifier"
+%token <text> INTEGER_LITERAL "integer literal"
+%token <text> FLOATING_LITERAL "floating point literal"
+%token <text> DECIMAL_LITERAL "decimal literal"
 
 /* syntax error */
 %token ERROR_TOKEN
 
-%type <identifier> subject predicate object verb literal resource blank collection
-%type <sequence> objectList itemList propertyList propertyListOpt
+%type <identifier> predicate object literal resource blank collection
 
 /* tidy up tokens after errors */
 
-%destructor {
-  if($$)
-    RAPTOR_FREE(char*, $$);
-} STRING_LITERAL BLANK_LITERAL INTEGER_LITERAL FLOATING_LITERAL DECIMAL_LITERAL IDENTIFIER
-
 %destructor {
   if($$)
     raptor_free_uri($$);
@@ -181,12 +191,7 @@ static void raptor_turtle_generate_statement(raptor_parser *parser, raptor_state
 %destructor {
   if($$)
     raptor_free_term($$);
-} subject predicate object verb literal resource blank collection
-
-%destructor {
-  if($$)
-    raptor_free_sequence($$);
-} objectList itemList propertyList propertyListOpt
+} predicate object literal resource blank collection
 
 %%
 
@@ -211,20 +216,7 @@ graph: GRAPH_NAME_LEFT_CURLY
       raptor_parser_start_graph(parser, turtle_parser->graph_name->value.uri, 1);
     }
   }
-  graphBody RIGHT_CURLY
-{
-  raptor_parser* parser = (raptor_parser *)rdf_parser;
-  raptor_turtle_parser* turtle_parser;
-
-  turtle_parser = (raptor_turtle_parser*)parser->context;
-
-  if(turtle_parser->trig) {
-    raptor_parser_end_graph(parser, turtle_parser->graph_name->value.uri, 1);
-    raptor_free_term(turtle_parser->graph_name);
-    turtle_parser->graph_name = NULL;
-    parser->emitted_default_graph = 0;
-  }
-}
+  graphBody graphEnd
 |
 LEFT_CURLY
   {
@@ -240,17 +232,34 @@ LEFT_CURLY
       parser->emitted_default_graph++;
     }
   }
-  graphBody RIGHT_CURLY
+  graphBody graphEnd
+|
+GRAPH_CONTINUE graphBody graphEnd
+;
+
+
+/* A graph left open by GRAPH_SUSPEND is resumed by GRAPH_CONTINUE at
+ * the start of the next part of the input
+ */
+graphEnd: RIGHT_CURLY
 {
   raptor_parser* parser = (raptor_parser *)rdf_parser;
   raptor_turtle_parser* turtle_parser;
 
   turtle_parser = (raptor_turtle_parser*)parser->context;
+
   if(turtle_parser->trig) {
-    raptor_parser_end_graph(parser, NULL, 1);
+    if(turtle_parser->graph_name) {
+      raptor_parser_end_graph(parser, turtle_parser->graph_name->value.uri, 1);
+      raptor_free_term(turtle_parser->graph_name);
+      turtle_parser->graph_name = NULL;
+    } else
+      raptor_parser_end_graph(parser, NULL, 1);
     parser->emitted_default_graph = 0;
   }
 }
+|
+GRAPH_SUSPEND
 ;
 
 
@@ -279,53 +288,21 @@ statement: directive
 
 triples: subject propertyList
 {
-  int i;
+  raptor_term* subject;
 
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("statement 2\n subject=");
-  if($1)
-    raptor_term_print_as_ntriples($1, stdout);
-  else
-    fputs("NULL", stdout);
-  if($2) {
-    printf("\n propertyList (reverse order to syntax)=");
-    raptor_sequence_print($2, stdout);
-    printf("\n");
-  } else     
-    printf("\n and empty propertyList\n");
-#endif
-
-  if($1 && $2) {
-    /* have subject and non-empty property list, handle it  */
-    for(i = 0; i < raptor_sequence_size($2); i++) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
-      t2->subject = raptor_term_copy($1);
-    }
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" after substitution propertyList=");
-    raptor_sequence_print($2, stdout);
-    printf("\n\n");
-#endif
-    for(i = 0; i < raptor_sequence_size($2); i++) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
-      raptor_turtle_generate_statement((raptor_parser*)rdf_parser, t2);
-    }
-  }
-
-  if($2)
-    raptor_free_sequence($2);
-
-  if($1)
-    raptor_free_term($1);
+  subject = raptor_turtle_pop_frame((raptor_parser*)rdf_parser);
+  if(subject)
+    raptor_free_term(subject);
 }
 | error DOT
+{
+  raptor_turtle_clear_frames((raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context));
+}
 ;
 
 
 objectList: objectList COMMA object
 {
-  raptor_statement *triple;
-
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("objectList 1\n");
   if($3) {
@@ -334,38 +311,15 @@ objectList: objectList COMMA object
     printf("\n");
   } else  
     printf(" and empty object\n");
-  if($1) {
-    printf(" objectList=");
-    raptor_sequence_print($1, stdout);
-    printf("\n");
-  } else
-    printf(" and empty objectList\n");
 #endif
 
-  if(!$3)
-    $$ = NULL;
-  else {
-    triple = raptor_new_statement_from_nodes(((raptor_parser*)rdf_parser)->world, NULL, NULL, $3, NULL);
-    if(!triple) {
-      raptor_free_sequence($1);
-      YYERROR;
-    }
-    if(raptor_sequence_push($1, triple)) {
-      raptor_free_sequence($1);
-      YYERROR;
-    }
-    $$ = $1;
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" objectList is now ");
-    raptor_sequence_print($$, stdout);
-    printf("\n\n");
-#endif
+  if($3) {
+    raptor_turtle_emit_object((raptor_parser*)rdf_parser, $3);
+    raptor_free_term($3);
   }
 }
 | object
 {
-  raptor_statement *triple;
-
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("objectList 2\n");
   if($1) {
@@ -376,82 +330,40 @@ objectList: objectList COMMA object
     printf(" and empty object\n");
 #endif
 
-  if(!$1)
-    $$ = NULL;
-  else {
-    triple = raptor_new_statement_from_nodes(((raptor_parser*)rdf_parser)->world, NULL, NULL, $1, NULL);
-    if(!triple)
-      YYERROR;
-#ifdef RAPTOR_DEBUG
-    $$ = raptor_new_sequence((raptor_data_free_handler)raptor_free_statement,
-                             (raptor_data_print_handler)raptor_statement_print);
-#else
-    $$ = raptor_new_sequence((raptor_data_free_handler)raptor_free_statement, NULL);
-#endif
-    if(!$$) {
-      raptor_free_statement(triple);
-      YYERROR;
-    }
-    if(raptor_sequence_push($$, triple)) {
-      raptor_free_sequence($$);
-      $$ = NULL;
-      YYERROR;
-    }
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" objectList is now ");
-    raptor_sequence_print($$, stdout);
-    printf("\n\n");
-#endif
+  if($1) {
+    raptor_turtle_emit_object((raptor_parser*)rdf_parser, $1);
+    raptor_free_term($1);
   }
 }
 ;
 
 itemList: itemList object
 {
-  raptor_statement *triple;
+  int rc = 0;
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("objectList 1\n");
+  printf("itemList 1\n");
   if($2) {
     printf(" object=\n");
     raptor_term_print_as_ntriples($2, stdout);
     printf("\n");
   } else  
     printf(" and empty object\n");
-  if($1) {
-    printf(" objectList=");
-    raptor_sequence_print($1, stdout);
-    printf("\n");
-  } else
-    printf(" and empty objectList\n");
 #endif
 
-  if(!$2)
-    $$ = NULL;
-  else {
-    triple = raptor_new_statement_from_nodes(((raptor_parser*)rdf_parser)->world, NULL, NULL, $2, NULL);
-    if(!triple) {
-      raptor_free_sequence($1);
-      YYERROR;
-    }
-    if(raptor_sequence_push($1, triple)) {
-      raptor_free_sequence($1);
-      YYERROR;
-    }
-    $$ = $1;
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" objectList is now ");
-    raptor_sequence_print($$, stdout);
-    printf("\n\n");
-#endif
+  if($2) {
+    rc = raptor_turtle_add_collection_item((raptor_parser*)rdf_parser, $2);
+    raptor_free_term($2);
   }
+  if(rc)
+    YYERROR;
 }
 | object
 {
-  raptor_statement *triple;
+  int rc = 0;
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("objectList 2\n");
+  printf("itemList 2\n");
   if($1) {
     printf(" object=\n");
     raptor_term_print_as_ntriples($1, stdout);
@@ -460,33 +372,12 @@ itemList: itemList object
     printf(" and empty object\n");
 #endif
 
-  if(!$1)
-    $$ = NULL;
-  else {
-    triple = raptor_new_statement_from_nodes(((raptor_parser*)rdf_parser)->world, NULL, NULL, $1, NULL);
-    if(!triple)
-      YYERROR;
-#ifdef RAPTOR_DEBUG
-    $$ = raptor_new_sequence((raptor_data_free_handler)raptor_free_statement,
-                             (raptor_data_print_handler)raptor_statement_print);
-#else
-    $$ = raptor_new_sequence((raptor_data_free_handler)raptor_free_statement, NULL);
-#endif
-    if(!$$) {
-      raptor_free_statement(triple);
-      YYERROR;
-    }
-    if(raptor_sequence_push($$, triple)) {
-      raptor_free_sequence($$);
-      $$ = NULL;
-      YYERROR;
-    }
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" objectList is now ");
-    raptor_sequence_print($$, stdout);
-    printf("\n\n");
-#endif
+  if($1) {
+    rc = raptor_turtle_add_collection_item((raptor_parser*)rdf_parser, $1);
+    raptor_free_term($1);
   }
+  if(rc)
+    YYERROR;
 }
 ;
 
@@ -498,123 +389,27 @@ verb: predicate
   printf("\n");
 #endif
 
-  $$ = $1;
+  raptor_turtle_set_predicate((raptor_parser*)rdf_parser, $1);
 }
 | A
 {
+  raptor_term* predicate;
+
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   printf("verb predicate = rdf:type (a)\n");
 #endif
 
-  $$ = raptor_term_copy(RAPTOR_RDF_type_term(((raptor_parser*)rdf_parser)->world));
-  if(!$$)
+  predicate = raptor_term_copy(RAPTOR_RDF_type_term(((raptor_parser*)rdf_parser)->world));
+  if(!predicate)
     YYERROR;
+  raptor_turtle_set_predicate((raptor_parser*)rdf_parser, predicate);
 }
 ;
 
 
 propertyList: propertyList SEMICOLON verb objectList
-{
-  int i;
-  
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("propertyList 1\n verb=");
-  raptor_term_print_as_ntriples($3, stdout);
-  printf("\n objectList=");
-  raptor_sequence_print($4, stdout);
-  printf("\n propertyList=");
-  raptor_sequence_print($1, stdout);
-  printf("\n\n");
-#endif
-  
-  if($4 == NULL) {
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" empty objectList not processed\n");
-#endif
-  } else if($3 && $4) {
-    /* non-empty property list, handle it  */
-    for(i = 0; i < raptor_sequence_size($4); i++) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($4, i);
-      t2->predicate = raptor_term_copy($3);
-    }
-  
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" after substitution objectList=");
-    raptor_sequence_print($4, stdout);
-    printf("\n");
-#endif
-  }
-
-  if($1 == NULL) {
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" empty propertyList not copied\n\n");
-#endif
-  } else if($3 && $4 && $1) {
-    while(raptor_sequence_size($4)) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_unshift($4);
-      if(raptor_sequence_push($1, t2)) {
-        raptor_free_sequence($1);
-        raptor_free_term($3);
-        raptor_free_sequence($4);
-        YYERROR;
-      }
-    }
-
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" after appending objectList (reverse order)=");
-    raptor_sequence_print($1, stdout);
-    printf("\n\n");
-#endif
-
-    raptor_free_sequence($4);
-  }
-
-  if($3)
-    raptor_free_term($3);
-
-  $$ = $1;
-}
 | verb objectList
-{
-  int i;
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("propertyList 2\n verb=");
-  raptor_term_print_as_ntriples($1, stdout);
-  if($2) {
-    printf("\n objectList=");
-    raptor_sequence_print($2, stdout);
-    printf("\n");
-  } else
-    printf("\n and empty objectList\n");
-#endif
-
-  if($1 && $2) {
-    for(i = 0; i < raptor_sequence_size($2); i++) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
-      t2->predicate = raptor_term_copy($1);
-    }
-
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf(" after substitution objectList=");
-    raptor_sequence_print($2, stdout);
-    printf("\n\n");
-#endif
-  }
-
-  if($1)
-    raptor_free_term($1);
-
-  $$ = $2;
-}
 | propertyList SEMICOLON
-{
-  $$ = $1;
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("propertyList 5\n trailing semicolon returning existing list ");
-  raptor_sequence_print($$, stdout);
-  printf("\n\n");
-#endif
-}
 ;
 
 directive : prefix | base
@@ -622,23 +417,27 @@ directive : prefix | base
 
 prefix: PREFIX IDENTIFIER URI_LITERAL DOT
 {
-  unsigned char *prefix = $2;
+  unsigned char *prefix = NULL;
+  size_t prefix_len = $2.length;
   raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
   raptor_namespace *ns;
 
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("directive @prefix %s %s\n",($2 ? (char*)$2 : "(default)"), raptor_uri_as_string($3));
+  printf("directive @prefix %.*s %s\n", (int)$2.length, (const char*)$2.string, raptor_uri_as_string($3));
 #endif
 
-  if(prefix) {
-    size_t len = strlen((const char*)prefix);
-    if(prefix[len-1] == ':') {
-      if(len == 1)
-         /* declaring default namespace prefix @prefix : ... */
-        prefix = NULL;
-      else
-        prefix[len-1]='\0';
+  /* declaring default namespace prefix @prefix : ... when empty */
+  if(prefix_len && $2.string[prefix_len-1] == ':')
+    prefix_len--;
+
+  if(prefix_len) {
+    prefix = RAPTOR_MALLOC(unsigned char*, prefix_len + 1);
+    if(!prefix) {
+      raptor_free_uri($3);
+      YYERROR;
     }
+    memcpy(prefix, $2.string, prefix_len);
+    prefix[prefix_len] = '\0';
   }
 
   ns = raptor_new_namespace_from_uri(&turtle_parser->namespaces, prefix, $3, 0);
@@ -647,8 +446,8 @@ prefix: PREFIX IDENTIFIER URI_LITERAL DOT
     raptor_parser_start_namespace((raptor_parser*)rdf_parser, ns);
   }
 
-  if($2)
-    RAPTOR_FREE(char*, $2);
+  if(prefix)
+    RAPTOR_FREE(char*, prefix);
   raptor_free_uri($3);
 
   if(!ns)
@@ -670,11 +469,13 @@ base: BASE URI_LITERAL DOT
 
 subject: resource
 {
-  $$ = $1;
+  if(raptor_turtle_push_frame((raptor_parser*)rdf_parser, $1))
+    YYERROR;
 }
 | blank
 {
-  $$ = $1;
+  if(raptor_turtle_push_frame((raptor_parser*)rdf_parser, $1))
+    YYERROR;
 }
 ;
 
@@ -710,33 +511,29 @@ object: resource
 literal: STRING_LITERAL AT IDENTIFIER
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal + language string=\"%s\"\n", $1);
+  printf("literal + language string=\"%.*s\"\n", (int)$1.length, (const char*)$1.string);
 #endif
 
-  $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    $1, NULL, $3);
-  RAPTOR_FREE(char*, $1);
-  RAPTOR_FREE(char*, $3);
+  $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                            $1.string, $1.length, NULL,
+                                            $3.string,
+                                            RAPTOR_BAD_CAST(unsigned char, $3.length));
   if(!$$)
     YYERROR;
 }
 | STRING_LITERAL AT IDENTIFIER HAT URI_LITERAL
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal + language=\"%s\" datatype string=\"%s\" uri=\"%s\"\n", $1, $3, raptor_uri_as_string($5));
+  printf("literal + language=\"%.*s\" datatype string=\"%.*s\" uri=\"%s\"\n", (int)$1.length, (const char*)$1.string, (int)$3.length, (const char*)$3.string, raptor_uri_as_string($5));
 #endif
 
   if($5) {
-    if($3) {
-      raptor_parser_warning((raptor_parser*)rdf_parser, 
-                            "Ignoring language used with datatyped literal");
-      RAPTOR_FREE(char*, $3);
-      $3 = NULL;
-    }
+    raptor_parser_warning((raptor_parser*)rdf_parser, 
+                          "Ignoring language used with datatyped literal");
   
-    $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                      $1, $5, NULL);
-    RAPTOR_FREE(char*, $1);
+    $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                              $1.string, $1.length, $5,
+                                              NULL, 0);
     raptor_free_uri($5);
     if(!$$)
       YYERROR;
@@ -747,20 +544,16 @@ literal: STRING_LITERAL AT IDENTIFIER
 | STRING_LITERAL AT IDENTIFIER HAT QNAME_LITERAL
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal + language=\"%s\" datatype string=\"%s\" qname URI=<%s>\n", $1, $3, raptor_uri_as_string($5));
+  printf("literal + language=\"%.*s\" datatype string=\"%.*s\" qname URI=<%s>\n", (int)$1.length, (const char*)$1.string, (int)$3.length, (const char*)$3.string, raptor_uri_as_string($5));
 #endif
 
   if($5) {
-    if($3) {
-      raptor_parser_warning((raptor_parser*)rdf_parser, 
-                            "Ignoring language used with datatyped literal");
-      RAPTOR_FREE(char*, $3);
-      $3 = NULL;
-    }
+    raptor_parser_warning((raptor_parser*)rdf_parser, 
+                          "Ignoring language used with datatyped literal");
   
-    $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                      $1, $5, NULL);
-    RAPTOR_FREE(char*, $1);
+    $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                              $1.string, $1.length, $5,
+                                              NULL, 0);
     raptor_free_uri($5);
     if(!$$)
       YYERROR;
@@ -771,13 +564,13 @@ literal: STRING_LITERAL AT IDENTIFIER
 | STRING_LITERAL HAT URI_LITERAL
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal + datatype string=\"%s\" uri=\"%s\"\n", $1, raptor_uri_as_string($3));
+  printf("literal + datatype string=\"%.*s\" uri=\"%s\"\n", (int)$1.length, (const char*)$1.string, raptor_uri_as_string($3));
 #endif
 
   if($3) {
-    $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                      $1, $3, NULL);
-    RAPTOR_FREE(char*, $1);
+    $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                              $1.string, $1.length, $3,
+                                              NULL, 0);
     raptor_free_uri($3);
     if(!$$)
       YYERROR;
@@ -788,13 +581,13 @@ literal: STRING_LITERAL AT IDENTIFIER
 | STRING_LITERAL HAT QNAME_LITERAL
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal + datatype string=\"%s\" qname URI=<%s>\n", $1, raptor_uri_as_string($3));
+  printf("literal + datatype string=\"%.*s\" qname URI=<%s>\n", (int)$1.length, (const char*)$1.string, raptor_uri_as_string($3));
 #endif
 
   if($3) {
-    $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                      $1, $3, NULL);
-    RAPTOR_FREE(char*, $1);
+    $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                              $1.string, $1.length, $3,
+                                              NULL, 0);
     raptor_free_uri($3);
     if(!$$)
       YYERROR;
@@ -804,96 +597,75 @@ literal: STRING_LITERAL AT IDENTIFIER
 | STRING_LITERAL
 {
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("literal string=\"%s\"\n", $1);
+  printf("literal string=\"%.*s\"\n", (int)$1.length, (const char*)$1.string);
 #endif
 
-  $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    $1, NULL, NULL);
-  RAPTOR_FREE(char*, $1);
+  $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                            $1.string, $1.length, NULL,
+                                            NULL, 0);
   if(!$$)
     YYERROR;
 }
 | INTEGER_LITERAL
 {
-  raptor_uri *uri;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("resource integer=%s\n", $1);
+  printf("resource integer=%.*s\n", (int)$1.length, (const char*)$1.string);
 #endif
-  uri = raptor_new_uri(((raptor_parser*)rdf_parser)->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#integer");
-  if(!uri) {
-    RAPTOR_FREE(char*, $1);
-    YYERROR;
-  }
-  $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
-  raptor_free_uri(uri);
+  $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                            $1.string, $1.length,
+                                            turtle_parser->xsd_integer_uri,
+                                            NULL, 0);
   if(!$$)
     YYERROR;
 }
 | FLOATING_LITERAL
 {
-  raptor_uri *uri;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("resource double=%s\n", $1);
+  printf("resource double=%.*s\n", (int)$1.length, (const char*)$1.string);
 #endif
-  uri = raptor_new_uri(((raptor_parser*)rdf_parser)->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#double");
-  if(!uri) {
-    RAPTOR_FREE(char*, $1);
-    YYERROR;
-  }
-  $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
-  raptor_free_uri(uri);
+  $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                            $1.string, $1.length,
+                                            turtle_parser->xsd_double_uri,
+                                            NULL, 0);
   if(!$$)
     YYERROR;
 }
 | DECIMAL_LITERAL
 {
-  raptor_uri *uri;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("resource decimal=%s\n", $1);
+  printf("resource decimal=%.*s\n", (int)$1.length, (const char*)$1.string);
 #endif
-  uri = raptor_new_uri(((raptor_parser*)rdf_parser)->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#decimal");
-  if(!uri) {
-    RAPTOR_FREE(char*, $1);
-    YYERROR;
-  }
-  $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    $1, uri, NULL);
-  RAPTOR_FREE(char*, $1);
-  raptor_free_uri(uri);
+  $$ = raptor_new_term_from_counted_literal(((raptor_parser*)rdf_parser)->world,
+                                            $1.string, $1.length,
+                                            turtle_parser->xsd_decimal_uri,
+                                            NULL, 0);
   if(!$$)
     YYERROR;
 }
 | TRUE_TOKEN
 {
-  raptor_uri *uri;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   fputs("resource boolean true\n", stderr);
 #endif
-  uri = raptor_new_uri(((raptor_parser*)rdf_parser)->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#boolean");
-  if(!uri)
-    YYERROR;
   $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    (const unsigned char*)"true", uri, NULL);
-  raptor_free_uri(uri);
+                                    (const unsigned char*)"true",
+                                    turtle_parser->xsd_boolean_uri, NULL);
   if(!$$)
     YYERROR;
 }
 | FALSE_TOKEN
 {
-  raptor_uri *uri;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
   fputs("resource boolean false\n", stderr);
 #endif
-  uri = raptor_new_uri(((raptor_parser*)rdf_parser)->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#boolean");
-  if(!uri)
-    YYERROR;
   $$ = raptor_new_term_from_literal(((raptor_parser*)rdf_parser)->world,
-                                    (const unsigned char*)"false", uri, NULL);
-  raptor_free_uri(uri);
+                                    (const unsigned char*)"false",
+                                    turtle_parser->xsd_boolean_uri, NULL);
   if(!$$)
     YYERROR;
 }
@@ -907,7 +679,12 @@ resource: URI_LITERAL
 #endif
 
   if($1) {
-    $$ = raptor_new_term_from_uri(((raptor_parser*)rdf_parser)->world, $1);
+    raptor_turtle_parser* turtle_parser;
+
+    turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
+    $$ = raptor_term_cache_get_term_from_uri(&turtle_parser->term_cache,
+                                             ((raptor_parser*)rdf_parser)->world,
+                                             $1);
     raptor_free_uri($1);
     if(!$$)
       YYERROR;
@@ -921,7 +698,12 @@ resource: URI_LITERAL
 #endif
 
   if($1) {
-    $$ = raptor_new_term_from_uri(((raptor_parser*)rdf_parser)->world, $1);
+    raptor_turtle_parser* turtle_parser;
+
+    turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
+    $$ = raptor_term_cache_get_term_from_uri(&turtle_parser->term_cache,
+                                             ((raptor_parser*)rdf_parser)->world,
+                                             $1);
     raptor_free_uri($1);
     if(!$$)
       YYERROR;
@@ -932,82 +714,44 @@ resource: URI_LITERAL
 
 
 propertyListOpt: propertyList
-{
-  $$ = $1;
-}
 | /* empty */
-{
-  $$ = NULL;
-}
+;
 
 
 blank: BLANK_LITERAL
 {
-  const unsigned char *id;
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("subject blank=\"%s\"\n", $1);
+  printf("subject blank=\"%.*s\"\n", (int)$1.length, (const char*)$1.string);
 #endif
-  id = raptor_world_internal_generate_id(((raptor_parser*)rdf_parser)->world,
-                                         $1);
-  if(!id)
-    YYERROR;
-
-  $$ = raptor_new_term_from_blank(((raptor_parser*)rdf_parser)->world, id);
-  RAPTOR_FREE(char*, id);
+  $$ = raptor_new_term_from_counted_generated_blank(((raptor_parser*)rdf_parser)->world,
+                                                     $1.string, $1.length);
 
   if(!$$)
     YYERROR;
 }
-| LEFT_SQUARE propertyListOpt RIGHT_SQUARE
-{
-  int i;
-  const unsigned char *id;
+| LEFT_SQUARE
+  {
+    /* action in mid-rule so the blank node is the subject of the
+     * triples in propertyListOpt */
+    raptor_term* blank;
 
-  id = raptor_world_generate_bnodeid(((raptor_parser*)rdf_parser)->world);
-  if(!id) {
-    if($2)
-      raptor_free_sequence($2);
-    YYERROR;
+    blank = raptor_new_term_from_blank(((raptor_parser*)rdf_parser)->world, NULL);
+    if(!blank)
+      YYERROR;
+    if(raptor_turtle_push_frame((raptor_parser*)rdf_parser, blank))
+      YYERROR;
   }
-
-  $$ = raptor_new_term_from_blank(((raptor_parser*)rdf_parser)->world, id);
-  RAPTOR_FREE(char*, id);
-  if(!$$) {
-    if($2)
-      raptor_free_sequence($2);
+  propertyListOpt RIGHT_SQUARE
+{
+  $$ = raptor_turtle_pop_frame((raptor_parser*)rdf_parser);
+  if(!$$)
     YYERROR;
-  }
 
-  if($2 == NULL) {
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf("resource\n propertyList=");
-    raptor_term_print_as_ntriples($$, stdout);
-    printf("\n");
-#endif
-  } else {
-    /* non-empty property list, handle it  */
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-    printf("resource\n propertyList=");
-    raptor_sequence_print($2, stdout);
-    printf("\n");
-#endif
-
-    for(i = 0; i < raptor_sequence_size($2); i++) {
-      raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
-      t2->subject = raptor_term_copy($$);
-      raptor_turtle_generate_statement((raptor_parser*)rdf_parser, t2);
-    }
-
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-    printf(" after substitution objectList=");
-    raptor_sequence_print($2, stdout);
-    printf("\n\n");
+  printf("resource\n blank=");
+  raptor_term_print_as_ntriples($$, stdout);
+  printf("\n");
 #endif
-
-    raptor_free_sequence($2);
-
-  }
-  
 }
 | collection
 {
@@ -1016,107 +760,35 @@ blank: BLANK_LITERAL
 ;
 
 
-collection: LEFT_ROUND itemList RIGHT_ROUND
+collection: LEFT_ROUND
+  {
+    /* action in mid-rule so the items are added to a new list */
+    if(raptor_turtle_push_frame((raptor_parser*)rdf_parser, NULL))
+      YYERROR;
+  }
+  itemList RIGHT_ROUND
 {
-  int i;
+  raptor_turtle_parser* turtle_parser = (raptor_turtle_parser*)(((raptor_parser*)rdf_parser)->context);
   raptor_world* world = ((raptor_parser*)rdf_parser)->world;
-  raptor_term* first_identifier = NULL;
-  raptor_term* rest_identifier = NULL;
-  raptor_term* object = NULL;
-  raptor_term* blank = NULL;
+  raptor_turtle_frame* frame;
 
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("collection\n objectList=");
-  raptor_sequence_print($2, stdout);
-  printf("\n");
-#endif
+  /* end the list: tail rdf:rest rdf:nil */
+  frame = &turtle_parser->frames[turtle_parser->frames_count - 1];
+  if(frame->tail)
+    raptor_turtle_generate_statement((raptor_parser*)rdf_parser, frame->tail,
+                                     RAPTOR_RDF_rest_term(world),
+                                     RAPTOR_RDF_nil_term(world));
+
+  /* the list is the first node */
+  $$ = raptor_turtle_pop_frame((raptor_parser*)rdf_parser);
+  if(!$$)
+    YYERROR;
 
-  first_identifier = raptor_new_term_from_uri(world, RAPTOR_RDF_first_URI(world));
-  if(!first_identifier)
-    goto err_collection;
-  rest_identifier = raptor_new_term_from_uri(world, RAPTOR_RDF_rest_URI(world));
-  if(!rest_identifier)
-    goto err_collection;
-  
-  /* non-empty property list, handle it  */
 #if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1  
-  printf("resource\n propertyList=");
-  raptor_sequence_print($2, stdout);
+  printf("collection\n head=");
+  raptor_term_print_as_ntriples($$, stdout);
   printf("\n");
 #endif
-
-  object = raptor_new_term_from_uri(world, RAPTOR_RDF_nil_URI(world));
-  if(!object)
-    goto err_collection;
-
-  for(i = raptor_sequence_size($2)-1; i>=0; i--) {
-    raptor_term* temp;
-    raptor_statement* t2 = (raptor_statement*)raptor_sequence_get_at($2, i);
-    const unsigned char *blank_id;
-
-    blank_id = raptor_world_generate_bnodeid(((raptor_parser*)rdf_parser)->world);
-    if(!blank_id)
-      goto err_collection;
-
-    blank = raptor_new_term_from_blank(((raptor_parser*)rdf_parser)->world,
-                                       blank_id);
-    RAPTOR_FREE(char*, blank_id);
-    if(!blank)
-      goto err_collection;
-    
-    t2->subject = blank;
-    t2->predicate = first_identifier;
-    /* t2->object already set to the value we want */
-    raptor_turtle_generate_statement((raptor_parser*)rdf_parser, t2);
-    
-    temp = t2->object;
-    
-    t2->subject = blank;
-    t2->predicate = rest_identifier;
-    t2->object = object;
-    raptor_turtle_generate_statement((raptor_parser*)rdf_parser, t2);
-
-    t2->subject = NULL;
-    t2->predicate = NULL;
-    t2->object = temp;
-
-    raptor_free_term(object);
-    object = blank;
-    blank = NULL;
-  }
-  
-#if defined(RAPTOR_DEBUG) && RAPTOR_DEBUG > 1
-  printf(" after substitution objectList=");
-  raptor_sequence_print($2, stdout);
-  printf("\n\n");
-#endif
-
-  raptor_free_sequence($2);
-
-  raptor_free_term(first_identifier);
-  raptor_free_term(rest_identifier);
-
-  $$=object;
-
-  break; /* success */
-
-  err_collection:
-
-  if(blank)
-    raptor_free_term(blank);
-
-  if(object)
-    raptor_free_term(object);
-
-  if(rest_identifier)
-    raptor_free_term(rest_identifier);
-
-  if(first_identifier)
-    raptor_free_term(first_identifier);
-
-  raptor_free_sequence($2);
-
-  YYERROR;
 }
 |  LEFT_ROUND RIGHT_ROUND 
 {
@@ -1223,6 +895,9 @@ turtle_parse(raptor_parser *rdf_parser, const char *string, size_t length)
 
   rc = turtle_parser_parse(rdf_parser);
 
+  /* frames left by a statement the parser gave up on */
+  raptor_turtle_clear_frames(turtle_parser);
+
   turtle_lexer_lex_destroy(turtle_parser->scanner);
   turtle_parser->scanner_set = 0;
 
@@ -1286,6 +961,9 @@ turtle_push_parse(raptor_parser *rdf_parser,
   } while (status == YYPUSH_MORE);
   yypstate_delete(ps);
 
+  /* frames left by a statement the parser gave up on */
+  raptor_turtle_clear_frames(turtle_parser);
+
   turtle_lexer_lex_destroy(turtle_parser->scanner);
   turtle_parser->scanner_set = 0;
 
@@ -1307,6 +985,14 @@ raptor_turtle_parse_init(raptor_parser* rdf_parser, const char *name) {
   if(raptor_namespaces_init(rdf_parser->world, &turtle_parser->namespaces, 0))
     return 1;
 
+  turtle_parser->xsd_boolean_uri = raptor_new_uri(rdf_parser->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#boolean");
+  turtle_parser->xsd_decimal_uri = raptor_new_uri(rdf_parser->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#decimal");
+  turtle_parser->xsd_double_uri = raptor_new_uri(rdf_parser->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#double");
+  turtle_parser->xsd_integer_uri = raptor_new_uri(rdf_parser->world, (const unsigned char*)"http://www.w3.org/2001/XMLSchema#integer");
+  if(!turtle_parser->xsd_boolean_uri || !turtle_parser->xsd_decimal_uri ||
+     !turtle_parser->xsd_double_uri || !turtle_parser->xsd_integer_uri)
+    return 1;
+
   turtle_parser->trig = !strcmp(name, "trig");
 
   return 0;
@@ -1324,6 +1010,7 @@ raptor_turtle_parse_init(raptor_parser* rdf_parser, const char *name) {
 static void
 raptor_turtle_parse_terminate(raptor_parser *rdf_parser) {
   raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)rdf_parser->context;
+  int i;
 
   raptor_namespaces_clear(&turtle_parser->namespaces);
 
@@ -1335,23 +1022,44 @@ raptor_turtle_parse_terminate(raptor_parser *rdf_parser) {
   if(turtle_parser->buffer)
     RAPTOR_FREE(cdata, turtle_parser->buffer);
 
+  for(i = 0; i < TURTLE_SCRATCH_COUNT; i++) {
+    if(turtle_parser->scratch[i])
+      RAPTOR_FREE(char*, turtle_parser->scratch[i]);
+  }
+
   if(turtle_parser->graph_name) {
     raptor_free_term(turtle_parser->graph_name);
     turtle_parser->graph_name = NULL;
   }
+
+  raptor_turtle_clear_frames(turtle_parser);
+  if(turtle_parser->frames)
+    RAPTOR_FREE(raptor_turtle_frame*, turtle_parser->frames);
+
+  if(turtle_parser->xsd_boolean_uri)
+    raptor_free_uri(turtle_parser->xsd_boolean_uri);
+  if(turtle_parser->xsd_decimal_uri)
+    raptor_free_uri(turtle_parser->xsd_decimal_uri);
+  if(turtle_parser->xsd_double_uri)
+    raptor_free_uri(turtle_parser->xsd_double_uri);
+  if(turtle_parser->xsd_integer_uri)
+    raptor_free_uri(turtle_parser->xsd_integer_uri);
+
+  raptor_term_cache_clear(&turtle_parser->term_cache);
 }
 
 
 static void
-raptor_turtle_generate_statement(raptor_parser *parser, raptor_statement *t)
+raptor_turtle_generate_statement(raptor_parser *parser, raptor_term *subject,
+                                 raptor_term *predicate, raptor_term *object)
 {
   raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
   raptor_statement *statement = &parser->statement;
 
-  if(!t->subject || !t->predicate || !t->object)
+  if(!subject || !predicate || !object)
     return;
 
-  if(!parser->statement_handler)
+  if(!parser->statement_handler && !parser->statement_batch_handler)
     return;
 
   if(turtle_parser->trig && turtle_parser->graph_name)
@@ -1363,50 +1071,29 @@ raptor_turtle_generate_statement(raptor_parser *parser, raptor_statement *t)
     parser->emitted_default_graph++;
   }
   
-  /* Two choices for subject for Turtle */
-  if(t->subject->type == RAPTOR_TERM_TYPE_BLANK) {
-    statement->subject = raptor_new_term_from_blank(parser->world,
-                                                    t->subject->value.blank.string);
-  } else {
-    /* RAPTOR_TERM_TYPE_URI */
-    RAPTOR_ASSERT(t->subject->type != RAPTOR_TERM_TYPE_URI,
-                  "subject type is not resource");
-    statement->subject = raptor_new_term_from_uri(parser->world,
-                                                  t->subject->value.uri);
-  }
+  /* Two choices for subject for Turtle; terms are shared with the
+   * grammar which takes them from the parser's term cache */
+  RAPTOR_ASSERT(subject->type != RAPTOR_TERM_TYPE_BLANK &&
+                subject->type != RAPTOR_TERM_TYPE_URI,
+                "subject type is not resource");
+  statement->subject = raptor_term_copy(subject);
 
   /* Predicates are URIs but check for bad ordinals */
-  if(!strncmp((const char*)raptor_uri_as_string(t->predicate->value.uri),
+  if(!strncmp((const char*)raptor_uri_as_string(predicate->value.uri),
               "http://www.w3.org/1999/02/22-rdf-syntax-ns#_", 44)) {
-    unsigned char* predicate_uri_string = raptor_uri_as_string(t->predicate->value.uri);
+    unsigned char* predicate_uri_string = raptor_uri_as_string(predicate->value.uri);
     int predicate_ordinal = raptor_check_ordinal(predicate_uri_string+44);
     if(predicate_ordinal <= 0)
       raptor_parser_error(parser, "Illegal ordinal value %d in property '%s'.", predicate_ordinal, predicate_uri_string);
   }
   
-  statement->predicate = raptor_new_term_from_uri(parser->world,
-                                                  t->predicate->value.uri);
-  
+  statement->predicate = raptor_term_copy(predicate);
 
   /* Three choices for object for Turtle */
-  if(t->object->type == RAPTOR_TERM_TYPE_URI) {
-    statement->object = raptor_new_term_from_uri(parser->world,
-                                                 t->object->value.uri);
-  } else if(t->object->type == RAPTOR_TERM_TYPE_BLANK) {
-    statement->object = raptor_new_term_from_blank(parser->world,
-                                                   t->object->value.blank.string);
-  } else {
-    /* RAPTOR_TERM_TYPE_LITERAL */
-    RAPTOR_ASSERT(t->object->type != RAPTOR_TERM_TYPE_LITERAL,
-                  "object type is not literal");
-    statement->object = raptor_new_term_from_literal(parser->world,
-                                                     t->object->value.literal.string,
-                                                     t->object->value.literal.datatype,
-                                                     t->object->value.literal.language);
-  }
+  statement->object = raptor_term_copy(object);
 
   /* Generate the statement */
-  (*parser->statement_handler)(parser->user_data, statement);
+  raptor_parser_emit_statement(parser, statement);
 
   raptor_free_term(statement->subject); statement->subject = NULL;
   raptor_free_term(statement->predicate); statement->predicate = NULL;
@@ -1418,6 +1105,354 @@ raptor_turtle_generate_statement(raptor_parser *parser, raptor_statement *t)
 
 
 
+/*
+ * raptor_turtle_push_frame:
+ * @parser: parser
+ * @subject: subject of the triples to read (or NULL for a collection)
+ *
+ * INTERNAL - Start reading the triples about a subject
+ *
+ * Takes ownership of @subject, even on failure.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_push_frame(raptor_parser *parser, raptor_term *subject)
+{
+  raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
+  raptor_turtle_frame *frame;
+
+  if(turtle_parser->frames_count == turtle_parser->frames_size) {
+    int size = turtle_parser->frames_size ? turtle_parser->frames_size << 1 : 8;
+    raptor_turtle_frame *frames;
+
+    frames = RAPTOR_REALLOC(raptor_turtle_frame*, turtle_parser->frames,
+                            size * sizeof(*frames));
+    if(!frames) {
+      if(subject)
+        raptor_free_term(subject);
+      return 1;
+    }
+    turtle_parser->frames = frames;
+    turtle_parser->frames_size = size;
+  }
+
+  frame = &turtle_parser->frames[turtle_parser->frames_count++];
+  frame->subject = subject;
+  frame->predicate = NULL;
+  frame->tail = NULL;
+
+  return 0;
+}
+
+
+/*
+ * raptor_turtle_pop_frame:
+ * @parser: parser
+ *
+ * INTERNAL - End reading the triples about the current subject
+ *
+ * Return value: the subject (or head of the collection) owned by the caller or NULL
+ */
+static raptor_term*
+raptor_turtle_pop_frame(raptor_parser *parser)
+{
+  raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
+  raptor_turtle_frame *frame;
+
+  if(!turtle_parser->frames_count)
+    return NULL;
+
+  frame = &turtle_parser->frames[--turtle_parser->frames_count];
+  if(frame->predicate)
+    raptor_free_term(frame->predicate);
+  if(frame->tail)
+    raptor_free_term(frame->tail);
+
+  return frame->subject;
+}
+
+
+/*
+ * raptor_turtle_clear_frames:
+ * @turtle_parser: turtle parser
+ *
+ * INTERNAL - Drop all frames such as after a syntax error
+ */
+static void
+raptor_turtle_clear_frames(raptor_turtle_parser *turtle_parser)
+{
+  while(turtle_parser->frames_count) {
+    raptor_turtle_frame *frame;
+
+    frame = &turtle_parser->frames[--turtle_parser->frames_count];
+    if(frame->subject)
+      raptor_free_term(frame->subject);
+    if(frame->predicate)
+      raptor_free_term(frame->predicate);
+    if(frame->tail)
+      raptor_free_term(frame->tail);
+  }
+}
+
+
+/*
+ * raptor_turtle_set_predicate:
+ * @parser: parser
+ * @predicate: predicate term (or NULL)
+ *
+ * INTERNAL - Set the predicate for the following objects of the current subject
+ *
+ * Takes ownership of @predicate.
+ */
+static void
+raptor_turtle_set_predicate(raptor_parser *parser, raptor_term *predicate)
+{
+  raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
+  raptor_turtle_frame *frame;
+
+  if(!turtle_parser->frames_count) {
+    if(predicate)
+      raptor_free_term(predicate);
+    return;
+  }
+
+  frame = &turtle_parser->frames[turtle_parser->frames_count - 1];
+  if(frame->predicate)
+    raptor_free_term(frame->predicate);
+  frame->predicate = predicate;
+}
+
+
+/*
+ * raptor_turtle_emit_object:
+ * @parser: parser
+ * @object: object term
+ *
+ * INTERNAL - Emit the triple for an object of the current subject and predicate
+ */
+static void
+raptor_turtle_emit_object(raptor_parser *parser, raptor_term *object)
+{
+  raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
+  raptor_turtle_frame *frame;
+
+  if(!turtle_parser->frames_count)
+    return;
+
+  frame = &turtle_parser->frames[turtle_parser->frames_count - 1];
+  raptor_turtle_generate_statement(parser, frame->subject, frame->predicate,
+                                   object);
+}
+
+
+/*
+ * raptor_turtle_add_collection_item:
+ * @parser: parser
+ * @object: item term
+ *
+ * INTERNAL - Emit the triples adding an item to the current collection
+ *
+ * Adds a new list node with rdf:first @object, linked from the
+ * previous node by rdf:rest.  The first node becomes the frame
+ * subject and is the value of the collection.
+ *
+ * Return value: non-0 on failure
+ */
+static int
+raptor_turtle_add_collection_item(raptor_parser *parser, raptor_term *object)
+{
+  raptor_turtle_parser *turtle_parser = (raptor_turtle_parser*)parser->context;
+  raptor_world *world = parser->world;
+  raptor_turtle_frame *frame;
+  raptor_term *node;
+
+  if(!turtle_parser->frames_count)
+    return 1;
+
+  frame = &turtle_parser->frames[turtle_parser->frames_count - 1];
+
+  node = raptor_new_term_from_blank(world, NULL);
+  if(!node)
+    return 1;
+
+  if(frame->tail) {
+    raptor_turtle_generate_statement(parser, frame->tail,
+                                     RAPTOR_RDF_rest_term(world), node);
+    raptor_free_term(frame->tail);
+  } else {
+    frame->subject = raptor_term_copy(node);
+    if(!frame->subject) {
+      raptor_free_term(node);
+      return 1;
+    }
+  }
+  frame->tail = node;
+
+  raptor_turtle_generate_statement(parser, node, RAPTOR_RDF_first_term(world),
+                                   object);
+
+  return 0;
+}
+
+
+/* Lexical states used when scanning for the end of statements */
+typedef enum {
+  TURTLE_SCAN_NORMAL,
+  TURTLE_SCAN_IRI,
+  TURTLE_SCAN_STRING,
+  TURTLE_SCAN_LONG_STRING,
+  TURTLE_SCAN_COMMENT
+} raptor_turtle_scan_state;
+
+
+/*
+ * raptor_turtle_scan_statements:
+ * @turtle_parser: turtle parser
+ *
+ * INTERNAL - Find the end of the last complete statement in the buffer
+ *
+ * Scans the bytes added to the buffer since the last call, tracking
+ * IRIs, string literals, comments, [ ( nesting and TRIG graph {
+ * nesting so that only a '.' followed by whitespace outside [ ( and
+ * at most one graph deep (or a TRIG graph '}' not followed by '.') is
+ * taken as the end of a statement.  The scan stops early if it needs
+ * more input to decide, and resumes from there on the next call.
+ *
+ * Sets turtle_parser->consumable to the length of the buffer prefix
+ * that contains only complete statements, or leaves it 0, and
+ * turtle_parser->consumable_in_graph if that prefix ends inside a
+ * graph.
+ */
+static void
+raptor_turtle_scan_statements(raptor_turtle_parser* turtle_parser)
+{
+  const unsigned char *buffer = (const unsigned char*)turtle_parser->buffer;
+  size_t len = turtle_parser->buffer_length;
+  size_t i = turtle_parser->scan_offset;
+  int state = turtle_parser->scan_state;
+  int depth = turtle_parser->scan_depth;
+  int graph_depth = turtle_parser->scan_graph_depth;
+  size_t graph_end = turtle_parser->scan_graph_end;
+
+  for(; i < len; i++) {
+    unsigned char c = buffer[i];
+
+    switch(state) {
+      case TURTLE_SCAN_IRI:
+        if(c == '>')
+          state = TURTLE_SCAN_NORMAL;
+        break;
+
+      case TURTLE_SCAN_COMMENT:
+        if(c == '\n' || c == '\r')
+          state = TURTLE_SCAN_NORMAL;
+        break;
+
+      case TURTLE_SCAN_STRING:
+        if(c == '\\') {
+          /* need the escaped character too */
+          if(i + 1 >= len)
+            goto done;
+          i++;
+        } else if(c == '"' || c == '\n' || c == '\r')
+          state = TURTLE_SCAN_NORMAL;
+        break;
+
+      case TURTLE_SCAN_LONG_STRING:
+        if(c == '\\') {
+          if(i + 1 >= len)
+            goto done;
+          i++;
+        } else if(c == '"') {
+          if(i + 2 >= len)
+            goto done;
+          if(buffer[i + 1] == '"' && buffer[i + 2] == '"') {
+            i += 2;
+            state = TURTLE_SCAN_NORMAL;
+          }
+        }
+        break;
+
+      case TURTLE_SCAN_NORMAL:
+      default:
+        /* anything but '.' after a top-level graph ends that statement */
+        if(graph_end && c != '.' && !isspace(c)) {
+          turtle_parser->consumable = graph_end;
+          turtle_parser->consumable_in_graph = 0;
+          graph_end = 0;
+        }
+
+        switch(c) {
+          case '<':
+            state = TURTLE_SCAN_IRI;
+            break;
+
+          case '#':
+            state = TURTLE_SCAN_COMMENT;
+            break;
+
+          case '"':
+            if(i + 2 >= len)
+              goto done;
+            if(buffer[i + 1] == '"' && buffer[i + 2] == '"') {
+              i += 2;
+              state = TURTLE_SCAN_LONG_STRING;
+            } else
+              state = TURTLE_SCAN_STRING;
+            break;
+
+          case '[':
+          case '(':
+            depth++;
+            break;
+
+          case ']':
+          case ')':
+            if(depth > 0)
+              depth--;
+            break;
+
+          case '{':
+            graph_depth++;
+            break;
+
+          case '}':
+            if(graph_depth > 0 && !--graph_depth && !depth)
+              graph_end = i + 1;
+            break;
+
+          case '.':
+            if(!depth && graph_depth <= 1) {
+              /* need the next character to tell "." from a decimal */
+              if(i + 1 >= len)
+                goto done;
+              graph_end = 0;
+              /* the parser can only resume inside a TRIG graph */
+              if((isspace(buffer[i + 1]) || buffer[i + 1] == '#') &&
+                 (!graph_depth || turtle_parser->trig)) {
+                turtle_parser->consumable = i + 1;
+                turtle_parser->consumable_in_graph = graph_depth;
+              }
+            }
+            break;
+
+          default:
+            break;
+        }
+        break;
+    }
+  }
+
+  done:
+  turtle_parser->scan_offset = i;
+  turtle_parser->scan_state = state;
+  turtle_parser->scan_depth = depth;
+  turtle_parser->scan_graph_depth = graph_depth;
+  turtle_parser->scan_graph_end = graph_end;
+}
+
+
 static int
 raptor_turtle_parse_chunk(raptor_parser* rdf_parser, 
                           const unsigned char *s, size_t len,
@@ -1425,7 +1460,8 @@ raptor_turtle_parse_chunk(raptor_parser* rdf_parser,
 {
   char *ptr;
   raptor_turtle_parser *turtle_parser;
-  int rc;
+  size_t consumable;
+  int rc = 0;
 
   turtle_parser = (raptor_turtle_parser*)rdf_parser->context;
   
@@ -1434,11 +1470,19 @@ raptor_turtle_parse_chunk(raptor_parser* rdf_parser,
 #endif
 
   if(len) {
-    turtle_parser->buffer = RAPTOR_REALLOC(char*, turtle_parser->buffer,
-                                           turtle_parser->buffer_length + len + 1);
-    if(!turtle_parser->buffer) {
-      raptor_parser_fatal_error(rdf_parser, "Out of memory");
-      return 1;
+    if(turtle_parser->buffer_length + len + 1 > turtle_parser->buffer_size) {
+      size_t new_size = turtle_parser->buffer_size << 1;
+
+      if(new_size < turtle_parser->buffer_length + len + 1)
+        new_size = turtle_parser->buffer_length + len + 1;
+
+      ptr = RAPTOR_REALLOC(char*, turtle_parser->buffer, new_size);
+      if(!ptr) {
+        raptor_parser_fatal_error(rdf_parser, "Out of memory");
+        return 1;
+      }
+      turtle_parser->buffer = ptr;
+      turtle_parser->buffer_size = new_size;
     }
 
     /* move pointer to end of cdata buffer */
@@ -1458,13 +1502,47 @@ raptor_turtle_parse_chunk(raptor_parser* rdf_parser,
 #endif
   }
   
-  /* if not end, wait for rest of input */
-  if(!is_end)
-    return 0;
+  /* if not end, parse the complete statements seen so far */
+  if(!is_end) {
+    raptor_turtle_scan_statements(turtle_parser);
+
+    consumable = turtle_parser->consumable;
+    if(!consumable)
+      return 0;
+
+    /* a prefix may start and/or end inside a TRIG graph */
+    turtle_parser->graph_continue = turtle_parser->graph_open;
+    turtle_parser->graph_suspend = turtle_parser->consumable_in_graph;
+
+#ifdef TURTLE_PUSH_PARSE
+    rc = turtle_push_parse(rdf_parser, turtle_parser->buffer, consumable);
+#else
+    rc = turtle_parse(rdf_parser, turtle_parser->buffer, consumable);
+#endif
+
+    turtle_parser->graph_open = turtle_parser->consumable_in_graph;
+    turtle_parser->graph_continue = 0;
+    turtle_parser->graph_suspend = 0;
+
+    /* move the incomplete statement left to the start of the buffer */
+    turtle_parser->buffer_length -= consumable;
+    memmove(turtle_parser->buffer, turtle_parser->buffer + consumable,
+            turtle_parser->buffer_length + 1);
+
+    turtle_parser->scan_offset -= consumable;
+    if(turtle_parser->scan_graph_end)
+      turtle_parser->scan_graph_end -= consumable;
+    turtle_parser->consumable = 0;
+    turtle_parser->consumable_in_graph = 0;
+
+    return rc;
+  }
 
   /* Nothing to do */
   if(!turtle_parser->buffer_length)
-    return 0;
+    goto end_graph;
+
+  turtle_parser->graph_continue = turtle_parser->graph_open;
 
 #ifdef TURTLE_PUSH_PARSE
   rc = turtle_push_parse(rdf_parser, 
@@ -1473,6 +1551,11 @@ raptor_turtle_parse_chunk(raptor_parser* rdf_parser,
   rc = turtle_parse(rdf_parser, turtle_parser->buffer, turtle_parser->buffer_length);
 #endif  
 
+  turtle_parser->buffer_length = 0;
+  turtle_parser->graph_open = 0;
+  turtle_parser->graph_continue = 0;
+
+  end_graph:
   if(rdf_parser->emitted_default_graph) {
     /* for non-TRIG - end default graph after last triple */
     raptor_parser_end_graph(rdf_parser, NULL, 0);
@@ -1496,11 +1579,23 @@ raptor_turtle_parse_start(raptor_parser *rdf_parser)
   locator->column= -1; /* No column info */
   locator->byte= -1; /* No bytes info */
 
-  if(turtle_parser->buffer_length) {
+  if(turtle_parser->buffer) {
     RAPTOR_FREE(cdata, turtle_parser->buffer);
     turtle_parser->buffer = NULL;
-    turtle_parser->buffer_length = 0;
   }
+  turtle_parser->buffer_length = 0;
+  turtle_parser->buffer_size = 0;
+
+  turtle_parser->scan_offset = 0;
+  turtle_parser->scan_state = TURTLE_SCAN_NORMAL;
+  turtle_parser->scan_depth = 0;
+  turtle_parser->scan_graph_depth = 0;
+  turtle_parser->scan_graph_end = 0;
+  turtle_parser->consumable = 0;
+  turtle_parser->consumable_in_graph = 0;
+  turtle_parser->graph_open = 0;
+  turtle_parser->graph_continue = 0;
+  turtle_parser->graph_suspend = 0;
   
   turtle_parser->lineno = 1;
 
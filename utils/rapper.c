@@ -330,6 +330,7 @@ main(int argc, char *argv[])
   raptor_uri *output_base_uri = NULL;
   raptor_sequence* serializer_options = NULL;
   raptor_sequence *namespace_declarations = NULL;
+  raptor_iostream *output_iostr = NULL;
 
   /* other variables */
   int rc;
@@ -901,8 +902,15 @@ main(int argc, char *argv[])
       serializer_options = NULL;
     }
 
-    raptor_serializer_start_to_file_handle(serializer, 
-                                          output_base_uri, stdout);
+    /* only the serializer writes to stdout so it can be buffered */
+    output_iostr = raptor_new_iostream_to_file_handle(world, stdout);
+    if(!output_iostr) {
+      fprintf(stderr, "%s: Failed to create output iostream\n", program);
+      return(1);
+    }
+    raptor_iostream_set_write_buffer_size(output_iostr, 65536);
+    raptor_serializer_start_to_iostream(serializer, output_base_uri,
+                                        output_iostr);
 
     if(!report_namespace)
       raptor_parser_set_namespace_handler(rdf_parser, serializer,
@@ -934,6 +942,8 @@ main(int argc, char *argv[])
     raptor_serializer_serialize_end(serializer);
     raptor_free_serializer(serializer);
   }
+  if(output_iostr)
+    raptor_free_iostream(output_iostr);
   
 
   if(!quiet) {